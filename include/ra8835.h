@@ -0,0 +1,1142 @@
+/**
+ * @ingroup     drivers_ra8835
+ *
+ * @{
+ * @file
+ * @brief       Public interface for the RA8835 graphic LCD driver
+ *
+ * @author      Alexander Podshivalov <a_podshivalov@mail.ru>
+ */
+#ifndef RA8835_H
+#define RA8835_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "mutex.h"
+#include "periph/gpio.h"
+#include "xtimer.h"
+#ifdef MODULE_PERIPH_GPIO_LL
+#include "periph/gpio_ll.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name    Driver configuration
+ * @{
+ */
+/**
+ * @brief   Route the bus through the host-side controller model
+ *
+ * When set, no GPIO is touched: every line access is handed to
+ * @ref ra8835_sim.h instead, which decodes the traffic into an emulated
+ * display RAM. Meant for the native board.
+ */
+#ifndef CONFIG_RA8835_SIM
+#define CONFIG_RA8835_SIM              (0)
+#endif
+
+/**
+ * @brief   Controller oscillator frequency in Hz, sets the bus cycle time
+ *
+ * A value lower than the real one is safe, just slower.
+ */
+#ifndef CONFIG_RA8835_FOSC_HZ
+#define CONFIG_RA8835_FOSC_HZ          (8000000UL)
+#endif
+
+/**
+ * @brief   CPU cycles taken by one iteration of the bus delay loop
+ *
+ * Used with CLOCK_CORECLOCK to turn the datasheet timings into loop counts
+ * at compile time. Erring low makes the delays longer, never too short.
+ */
+#ifndef CONFIG_RA8835_DELAY_LOOP_CYCLES
+#define CONFIG_RA8835_DELAY_LOOP_CYCLES (3U)
+#endif
+
+/**
+ * @brief   Largest display width in pixels a @ref ra8835_fb_t can shadow
+ */
+#ifndef CONFIG_RA8835_FB_COLS
+#define CONFIG_RA8835_FB_COLS          (320U)
+#endif
+
+/**
+ * @brief   Largest display height in pixels a @ref ra8835_fb_t can shadow
+ */
+#ifndef CONFIG_RA8835_FB_ROWS
+#define CONFIG_RA8835_FB_ROWS          (240U)
+#endif
+
+/**
+ * @brief   Largest text layer in characters a @ref ra8835_text_t can
+ *          shadow, 40 x 30 fits a 320x240 panel
+ */
+#ifndef CONFIG_RA8835_TEXT_SIZE
+#define CONFIG_RA8835_TEXT_SIZE        (1200U)
+#endif
+
+/**
+ * @brief   Keep a second, pre-flipped copy of the font in flash
+ *
+ * Upside-down displays then get their glyphs with a plain burst instead of
+ * a table lookup per byte, for 2 KB of flash. Set to 0 to save the flash.
+ */
+#ifndef CONFIG_RA8835_FLIPPED_FONT
+#define CONFIG_RA8835_FLIPPED_FONT     (1)
+#endif
+
+/**
+ * @brief   Count bus traffic and time the main drawing calls into the
+ *          @ref ra8835_stats_t attached to the descriptor
+ *
+ * Off by default, the driver then carries no trace of it.
+ */
+#ifndef CONFIG_RA8835_STATS
+#define CONFIG_RA8835_STATS            (0)
+#endif
+
+/**
+ * @brief   Histogram bins per timed call
+ *
+ * Bin i counts calls that took 2^i to 2^(i+1) - 1 us, bin 0 includes
+ * 0 us and the last bin everything longer.
+ */
+#ifndef CONFIG_RA8835_STATS_BINS
+#define CONFIG_RA8835_STATS_BINS       (16U)
+#endif
+
+/**
+ * @brief   Transfers one @ref ra8835_async_t can queue
+ */
+#ifndef CONFIG_RA8835_ASYNC_QUEUE
+#define CONFIG_RA8835_ASYNC_QUEUE      (4U)
+#endif
+
+/**
+ * @brief   Bytes sent per timer tick of an asynchronous transfer
+ *
+ * The CPU is taken for this long at a time, about 90 us with the port
+ * mapped bus and a few hundred with the per-pin one.
+ */
+#ifndef CONFIG_RA8835_ASYNC_CHUNK
+#define CONFIG_RA8835_ASYNC_CHUNK      (64U)
+#endif
+
+/**
+ * @brief   Time between two ticks of an asynchronous transfer in us
+ */
+#ifndef CONFIG_RA8835_ASYNC_PERIOD_US
+#define CONFIG_RA8835_ASYNC_PERIOD_US  (500U)
+#endif
+
+/**
+ * @brief   Number of bitmaps a @ref ra8835_sprite_cache_t keeps track of
+ */
+#ifndef CONFIG_RA8835_SPRITE_SLOTS
+#define CONFIG_RA8835_SPRITE_SLOTS     (8U)
+#endif
+/** @} */
+
+/**
+ * @brief   Length of the font signature kept right after the glyphs
+ *
+ * Holds a magic number, a checksum of the font, the orientation it was
+ * uploaded for and which glyphs are present. ra8835_init() reads it back
+ * first, so after a warm reset the font costs a 40 byte read instead of a
+ * 2 KB upload.
+ */
+#define RA8835_FONT_SIG_SIZE           (8U + 256U / 8U)
+
+/**
+ * @brief   Flag of a repeat control byte in a run-length coded picture
+ *
+ * The stream is a sequence of runs, each started by a control byte c:
+ * - c < 0x80: c + 1 literal bytes follow
+ * - c >= 0x80: the next byte is repeated (c & 0x7F) + 2 times
+ */
+#define RA8835_RLE_REPEAT              (0x80U)
+
+/**
+ * @brief   How D0..D7 are driven
+ */
+typedef enum {
+    RA8835_BUS_AUTO,            /**< port mapped when possible, else per pin */
+    RA8835_BUS_PIN,             /**< one GPIO call per data line */
+    RA8835_BUS_PORT,            /**< all data lines with one port access,
+                                     needs periph_gpio_ll and D0..D7 on a
+                                     single port */
+} ra8835_bus_t;
+
+#if defined(MODULE_PERIPH_GPIO_LL) || defined(DOXYGEN)
+/**
+ * @brief   Port mapping of the data lines, filled in by ra8835_init()
+ *
+ * The set mask of a byte is `lo[value & 0x0F] | hi[value >> 4]`, the clear
+ * mask is the rest of @p mask. Two nibble tables instead of one 256 entry
+ * table keep the descriptor small.
+ */
+typedef struct {
+    gpio_port_t port;           /**< port holding D0..D7 */
+    uword_t mask;               /**< all data lines */
+    uword_t lo[16];             /**< set mask for D0..D3 */
+    uword_t hi[16];             /**< set mask for D4..D7 */
+} ra8835_port_t;
+#endif
+
+/**
+ * @brief   What a pixel operation does to the pixels it hits
+ */
+typedef enum {
+    RA8835_PIXEL_SET,           /**< turn pixels on */
+    RA8835_PIXEL_CLEAR,         /**< turn pixels off */
+    RA8835_PIXEL_TOGGLE,        /**< invert pixels */
+} ra8835_pixel_op_t;
+
+/**
+ * @brief   How the layers are combined on screen (MX bits of OVLAY)
+ */
+typedef enum {
+    RA8835_MIX_OR,              /**< a pixel is on if it is on in any layer */
+    RA8835_MIX_XOR,             /**< layer 1 XOR layer 2, OR layer 3 */
+    RA8835_MIX_AND,             /**< layer 1 AND layer 2, OR layer 3 */
+    RA8835_MIX_POR,             /**< priority OR, shown like OR on a
+                                     monochrome panel */
+} ra8835_mix_t;
+
+/**
+ * @brief   Regions of display RAM, see @ref ra8835_map_t
+ */
+typedef enum {
+    RA8835_MAP_LAYER1,          /**< text screen, or a graphics plane in
+                                     three-layer mode */
+    RA8835_MAP_LAYER2,          /**< all graphics pages, one after another */
+    RA8835_MAP_LAYER3,          /**< third graphics plane, three-layer mode */
+    RA8835_MAP_CGRAM,           /**< character generator, 256 glyphs of
+                                     8 bytes and the font signature */
+    RA8835_MAP_FREE,            /**< not used by the driver itself */
+    RA8835_MAP_NUMOF,           /**< number of regions */
+} ra8835_map_id_t;
+
+/**
+ * @brief   A region of display RAM
+ */
+typedef struct {
+    uint16_t addr;              /**< first byte */
+    uint16_t size;              /**< length in bytes, 0 if unused */
+} ra8835_region_t;
+
+/**
+ * @brief   Layout of the 32 KB display RAM
+ *
+ * Every display address the driver uses is derived from here. Left zeroed
+ * in the descriptor, ra8835_init() fills in the default layout from
+ * ra8835_map_plan(); a layout set up by the application is checked with
+ * ra8835_map_check() instead.
+ */
+typedef struct {
+    ra8835_region_t region[RA8835_MAP_NUMOF]; /**< indexed by
+                                                   @ref ra8835_map_id_t */
+} ra8835_map_t;
+
+/**
+ * @brief   RAM shadow of the graphics layer
+ *
+ * Drawing goes to @p pix, ra8835_flush() sends what changed since the last
+ * flush. Pixels are stored as the application sees them, the flush takes
+ * care of upside-down panels. Each row keeps one dirty byte span.
+ */
+typedef struct {
+    uint8_t pix[CONFIG_RA8835_FB_ROWS * CONFIG_RA8835_FB_COLS / 8]; /**< pixels */
+    uint8_t lo[CONFIG_RA8835_FB_ROWS];  /**< first dirty byte of a row */
+    uint8_t hi[CONFIG_RA8835_FB_ROWS];  /**< one past the last dirty byte,
+                                             0 if the row is clean */
+} ra8835_fb_t;
+
+/**
+ * @brief   Pending change of one display RAM byte in a @ref ra8835_dl_t
+ *
+ * The byte becomes (old & @p keep) ^ @p flip, both in panel orientation.
+ */
+typedef struct {
+    uint16_t addr;              /**< display RAM address */
+    uint8_t keep;               /**< bits of the old content that stay */
+    uint8_t flip;               /**< bits toggled after that */
+} ra8835_dl_op_t;
+
+/**
+ * @brief   Display list, a low RAM alternative to @ref ra8835_fb_t
+ *
+ * Graphics drawing calls record byte changes here instead of going to
+ * the bus. ra8835_flush() sorts them by address, folds changes of the
+ * same byte together and replays them in one pass. Consecutive bytes
+ * share one CSRW and one MWRITE burst, and bytes that need the old
+ * content share one MREAD. A full list is replayed on its own. The text
+ * layer is not recorded. Set @p ops and @p size, zero the rest.
+ */
+typedef struct {
+    ra8835_dl_op_t *ops;        /**< storage for recorded changes */
+    uint16_t size;              /**< number of entries in @p ops */
+    uint16_t num;               /**< entries in use */
+} ra8835_dl_t;
+
+/**
+ * @brief   RAM shadow of the text layer
+ *
+ * Holds the characters on the text layer line by line as the application
+ * sees them, ra8835_text_update() compares against it and only sends what
+ * differs. The driver keeps it up to date, nothing needs to be set. It
+ * is not used with three graphics layers.
+ */
+typedef struct {
+    uint8_t chr[CONFIG_RA8835_TEXT_SIZE]; /**< characters */
+} ra8835_text_t;
+
+/**
+ * @brief   A range of character codes, both ends included
+ */
+typedef struct {
+    uint8_t first;              /**< first code */
+    uint8_t last;               /**< last code */
+} ra8835_glyphs_t;
+
+/**
+ * @brief   Which glyphs go to the character generator and when
+ *
+ * Without one attached, ra8835_init() uploads all 256 glyphs. With one,
+ * only the glyphs in @p ranges are uploaded at init, and with @p lazy set
+ * any other glyph is uploaded the first time it is written to the text
+ * layer. Either way glyphs already found in the character generator after
+ * a warm reset are not sent again, see @ref RA8835_FONT_SIG_SIZE.
+ */
+typedef struct {
+    const ra8835_glyphs_t *ranges; /**< glyphs to upload at init */
+    uint8_t num;                /**< number of entries in @p ranges */
+    uint8_t lazy;               /**< upload other glyphs on first use */
+    uint8_t loaded[256 / 8];    /**< glyphs in the character generator, one
+                                     bit per code, kept by the driver */
+} ra8835_font_t;
+
+/**
+ * @brief   A bitmap held in display RAM by a @ref ra8835_sprite_cache_t
+ */
+typedef struct {
+    const uint8_t *src;         /**< bitmap in MCU memory it was loaded from,
+                                     NULL if the slot is empty */
+    uint16_t addr;              /**< where it is in display RAM */
+    uint16_t size;              /**< its length in bytes */
+    uint32_t used;              /**< when it was last asked for */
+    uint8_t pinned;             /**< shown as a strip, must stay */
+} ra8835_sprite_slot_t;
+
+/**
+ * @brief   Bitmaps kept in the free part of display RAM
+ *
+ * Zero it before first use. Bitmaps are identified by their address in
+ * MCU memory and evicted least recently used first when the free region
+ * or the slots run out. The counters are never reset by the driver, the
+ * hit rate is @p hits / (@p hits + @p misses).
+ */
+typedef struct {
+    ra8835_sprite_slot_t slot[CONFIG_RA8835_SPRITE_SLOTS]; /**< bitmaps */
+    uint32_t tick;              /**< requests so far, for LRU */
+    uint32_t hits;              /**< requests found in display RAM */
+    uint32_t misses;            /**< requests that had to be uploaded */
+    uint32_t evictions;         /**< bitmaps dropped to make room */
+} ra8835_sprite_cache_t;
+
+/**
+ * @brief   Controller state as the driver last left it
+ *
+ * With one attached the driver skips cursor moves, direction changes and
+ * MWRITE commands that would change nothing, and knows the cursor without
+ * reading it back. ra8835_init() sets it up, nothing needs to be set.
+ */
+typedef struct {
+    uint16_t cursor;            /**< cursor address, if @p known */
+    uint16_t count;             /**< bytes written since the last command */
+    uint16_t ap;                /**< bytes per line, for UP and DOWN */
+    uint8_t known;              /**< @p cursor is valid */
+    uint8_t dir;                /**< last CSRDIR command, 0 if unknown */
+    uint8_t cmd;                /**< last command sent */
+} ra8835_ctl_t;
+
+/**
+ * @brief   Calls timed with @ref CONFIG_RA8835_STATS
+ */
+typedef enum {
+    RA8835_STATS_WRITE_IMG,     /**< ra8835_write_img() and variants */
+    RA8835_STATS_LINE,          /**< ra8835_line() */
+    RA8835_STATS_TEXT_PRINT,    /**< ra8835_text_print() */
+    RA8835_STATS_CLEAR,         /**< ra8835_clear() */
+    RA8835_STATS_FLUSH,         /**< ra8835_flush() */
+    RA8835_STATS_NUMOF,         /**< number of timed calls */
+} ra8835_stats_id_t;
+
+/**
+ * @brief   Timing of one kind of call
+ */
+typedef struct {
+    uint32_t count;             /**< calls so far */
+    uint32_t min_us;            /**< shortest call */
+    uint32_t max_us;            /**< longest call */
+    uint64_t total_us;          /**< all calls together, for the mean */
+    uint32_t hist[CONFIG_RA8835_STATS_BINS]; /**< calls by duration, see
+                                                  @ref CONFIG_RA8835_STATS_BINS */
+} ra8835_stats_call_t;
+
+/**
+ * @brief   Bus traffic and call timing, see @ref CONFIG_RA8835_STATS
+ *
+ * Zero it to start over. Timing uses xtimer, or the simulated clock with
+ * @ref CONFIG_RA8835_SIM.
+ */
+typedef struct {
+    uint32_t bytes;             /**< bytes written, commands included */
+    uint32_t cmds;              /**< commands sent */
+    uint32_t cursor_moves;      /**< CSRW commands among them */
+    uint32_t reads;             /**< bytes read back */
+    ra8835_stats_call_t call[RA8835_STATS_NUMOF]; /**< per call timing */
+} ra8835_stats_t;
+
+/**
+ * @brief   Device descriptor for the RA8835 display
+ */
+typedef struct {
+    uint16_t cols;              /**< display width in pixels */
+    uint16_t rows;              /**< display height in pixels */
+    gpio_t wr;                  /**< ~WR line */
+    gpio_t rd;                  /**< ~RD line */
+    gpio_t cs;                  /**< ~CS line */
+    gpio_t a0;                  /**< A0 line */
+    gpio_t rst;                 /**< ~RST line */
+    gpio_t data[8];             /**< D0..D7 lines */
+    uint8_t upside_down;        /**< panel is mounted rotated by 180 degrees */
+    ra8835_bus_t bus;           /**< data bus backend, AUTO is resolved by
+                                     ra8835_init() */
+#if defined(MODULE_PERIPH_GPIO_LL) || defined(DOXYGEN)
+    ra8835_port_t port;         /**< port mapping for RA8835_BUS_PORT */
+#endif
+    ra8835_fb_t *fb;            /**< optional shadow of the graphics layer,
+                                     NULL to draw straight to the display */
+    ra8835_dl_t *dl;            /**< optional display list, only used
+                                     without @p fb */
+    ra8835_ctl_t *ctl;          /**< optional controller state, NULL to
+                                     send every command */
+    ra8835_text_t *text;        /**< optional shadow of the text layer,
+                                     NULL to not keep one */
+    uint8_t pages;              /**< graphics pages kept in display RAM,
+                                     0 counts as 1 */
+    uint8_t page;               /**< page drawn to, see ra8835_draw_page() */
+    uint16_t scroll;            /**< first graphics line shown, see
+                                     ra8835_scroll() */
+    uint16_t width;             /**< width of the layers in display RAM in
+                                     pixels, a multiple of 8 not below
+                                     @p cols, 0 means @p cols */
+    uint16_t hscroll;           /**< first column shown, see
+                                     ra8835_hscroll() */
+    ra8835_mix_t mix;           /**< layer composition, see ra8835_set_mix() */
+    uint8_t layers;             /**< 3 for three graphics layers, anything
+                                     else for text over graphics */
+    uint8_t layer;              /**< layer drawn to, see ra8835_draw_layer() */
+    ra8835_map_t map;           /**< display RAM layout */
+    uint16_t strip;             /**< display address of the strip shown at
+                                     the bottom, see ra8835_sprite_strip() */
+    uint16_t strip_lines;       /**< its height, 0 if none is shown */
+    ra8835_font_t *font;        /**< optional glyph selection, NULL to
+                                     upload the whole font at init */
+#if CONFIG_RA8835_STATS || defined(DOXYGEN)
+    ra8835_stats_t *stats;      /**< counters, NULL to not count */
+#endif
+} ra8835_t;
+
+/**
+ * @brief   Initialize the display: reset it, set up the layers, upload the
+ *          font and clear both layers
+ *
+ * @param[in,out] dev   device descriptor
+ *
+ * @return  0 on success
+ * @return  any error of ra8835_map_plan() or ra8835_map_check(), the
+ *          display is not touched then
+ */
+int ra8835_init(ra8835_t *dev);
+
+/**
+ * @brief   Plan the default display RAM layout for a descriptor
+ *
+ * Layer 1 starts at 0, the graphics pages follow, then layer 3 if there
+ * is one. The character generator stays at 0x7000 where the panels this
+ * driver was tested with expect it. The largest gap left over becomes
+ * RA8835_MAP_FREE.
+ *
+ * @param[in] dev       device descriptor, geometry, @p width, @p pages and
+ *                      @p layers are used
+ * @param[out] map      layout
+ *
+ * @return  0 on success
+ * @return  -ENOMEM if the layers do not fit
+ */
+int ra8835_map_plan(const ra8835_t *dev, ra8835_map_t *map);
+
+/**
+ * @brief   Check a display RAM layout against a descriptor
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] map       layout
+ *
+ * @return  0 if the layout is usable
+ * @return  -EINVAL if a region is too small for what the descriptor needs
+ *          or regions overlap
+ * @return  -ENOMEM if a region reaches beyond the 32 KB display RAM
+ */
+int ra8835_map_check(const ra8835_t *dev, const ra8835_map_t *map);
+
+/**
+ * @brief   Send a command followed by its parameters or display data
+ *
+ * ~CS and A0 are set once for the whole transaction, each byte then only
+ * costs a ~WR strobe. This is the fast path for MWRITE streams.
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] cmd       command byte, e.g. RA8835_MWRITE
+ * @param[in] buf       parameters or data, may be NULL if @p len is 0
+ * @param[in] len       number of bytes in @p buf
+ */
+void ra8835_write_burst(const ra8835_t *dev, uint8_t cmd, const uint8_t *buf, size_t len);
+
+/**
+ * @brief   Fill a range of display RAM with one byte value
+ *
+ * The data lines are set once and every further byte is a single ~WR
+ * strobe, far cheaper than sending the bytes one by one. The address is
+ * raw display RAM, orientation and the shadow are not looked at, see
+ * ra8835_map_plan() for where the layers are.
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] addr      first display RAM address
+ * @param[in] len       number of bytes
+ * @param[in] value     byte to write
+ */
+void ra8835_fill_region(const ra8835_t *dev, uint16_t addr, size_t len, uint8_t value);
+
+/**
+ * @brief   Fill the text layer with blanks and move the text cursor to the
+ *          upper left corner
+ *
+ * @param[in] dev       device descriptor
+ */
+void ra8835_text_clear(const ra8835_t *dev);
+
+/**
+ * @brief   Move the text cursor to the upper left corner
+ *
+ * @param[in] dev       device descriptor
+ */
+void ra8835_text_home(const ra8835_t *dev);
+
+/**
+ * @brief   Move the text cursor
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] col       character column
+ * @param[in] row       character row
+ */
+void ra8835_text_set_cursor(const ra8835_t *dev, uint8_t col, uint8_t row);
+
+/**
+ * @brief   Write a single character at the text cursor
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] value     character code
+ */
+void ra8835_text_write(const ra8835_t *dev, uint8_t value);
+
+/**
+ * @brief   Write a zero terminated string at the text cursor
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] data      string to print
+ */
+void ra8835_text_print(const ra8835_t *dev, const char *data);
+
+/**
+ * @brief   Put a string at a position, only sending characters that change
+ *
+ * With a @ref ra8835_text_t attached the string is compared against it
+ * and only the runs of differing characters are written, so redrawing a
+ * screen where a few digits changed costs little more than those digits.
+ * Without one the whole string is written. The string is cut off at the
+ * end of the text layer. The text cursor is left somewhere in the string.
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] col       character column
+ * @param[in] row       character row
+ * @param[in] data      string to put there
+ */
+void ra8835_text_update(const ra8835_t *dev, uint8_t col, uint8_t row,
+                        const char *data);
+
+/**
+ * @brief   Print formatted text at a position
+ *
+ * The characters go to the text layer as they are formatted, a few at a
+ * time, with no buffer for the whole string and no heap. With a
+ * @ref ra8835_text_t attached only the characters that change are sent,
+ * as with ra8835_text_update(). The output is cut off at the end of the
+ * text layer and the text cursor is left somewhere in it.
+ *
+ * Understands %%c, %%s, %%d, %%i, %%u, %%x and %%X with the flags '-' and
+ * '0', a field width, also as '*', a precision for %%s and the 'l' length
+ * modifier. There is no floating point.
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] col       character column
+ * @param[in] row       character row
+ * @param[in] fmt       format string
+ *
+ * @return  number of characters formatted, including any cut off
+ */
+int ra8835_text_printf(const ra8835_t *dev, uint8_t col, uint8_t row,
+                       const char *fmt, ...);
+
+/**
+ * @brief   Clear the graphics layer
+ *
+ * With a shadow attached this only touches RAM, see ra8835_flush().
+ *
+ * @param[in] dev       device descriptor
+ */
+void ra8835_clear(const ra8835_t *dev);
+
+/**
+ * @brief   Write a full screen image to the graphics layer
+ *
+ * With a shadow attached this only touches RAM, see ra8835_flush().
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] img       rows * width / 8 bytes, MSB is the leftmost pixel
+ */
+void ra8835_write_img(const ra8835_t *dev, const char img[]);
+
+/**
+ * @brief   Write a full screen image that is already in the panel's own
+ *          orientation to the graphics layer
+ *
+ * For upside-down displays @p img has to be turned around beforehand,
+ * bytes in reverse order and bits in each byte mirrored, e.g. with
+ * `tools/ra8835_img.py --flip`. The image then goes out as one plain
+ * burst, without the per-byte table lookup of ra8835_write_img(). For
+ * other displays both functions are the same.
+ *
+ * With a shadow attached this only touches RAM, see ra8835_flush().
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] img       rows * width / 8 bytes
+ */
+void ra8835_write_img_native(const ra8835_t *dev, const uint8_t img[]);
+
+/**
+ * @brief   Write a run-length coded full screen picture to the graphics
+ *          layer
+ *
+ * The picture is decoded straight into the display write, there is no
+ * buffer for it in RAM. Repeated bytes are sent by holding the data lines
+ * and strobing ~WR only, so blank areas come cheap. Like for
+ * ra8835_write_img_native(), the decoded bytes have to be in the panel's
+ * own orientation. `tools/ra8835_img.py --rle` produces such streams.
+ *
+ * With a shadow attached this only touches RAM, see ra8835_flush().
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] rle       coded picture, see @ref RA8835_RLE_REPEAT
+ * @param[in] size      size of @p rle in bytes
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p rle does not decode to exactly rows * width / 8
+ *          bytes, nothing is written then
+ */
+int ra8835_write_img_rle(const ra8835_t *dev, const uint8_t *rle, size_t size);
+
+/**
+ * @brief   Set a single pixel on the graphics layer
+ *
+ * Same as ra8835_pixel() with RA8835_PIXEL_SET.
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] x         column
+ * @param[in] y         row
+ */
+void ra8835_put_pixel(const ra8835_t *dev, int x, int y);
+
+/**
+ * @brief   Set, clear or toggle a single pixel on the graphics layer
+ *
+ * The other pixels sharing the display byte are left alone. Without a
+ * shadow the byte is read back through MREAD first, which turns the data
+ * lines around twice; with a shadow this only touches RAM, see
+ * ra8835_flush(). Pixels off screen are ignored.
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] x         column
+ * @param[in] y         row
+ * @param[in] op        what to do with the pixel
+ */
+void ra8835_pixel(const ra8835_t *dev, int x, int y, ra8835_pixel_op_t op);
+
+/**
+ * @brief   Draw a line on the graphics layer
+ *
+ * Pixels falling into the same display byte are combined into one read-
+ * modify-write, the rest of the byte is preserved. With a shadow attached
+ * this only touches RAM, see ra8835_flush(). Parts off screen are clipped.
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] x1        start column
+ * @param[in] y1        start row
+ * @param[in] x2        end column
+ * @param[in] y2        end row
+ */
+void ra8835_line(const ra8835_t *dev, int x1, int y1, int x2, int y2);
+
+/**
+ * @brief   Draw a horizontal line on the graphics layer
+ *
+ * Same as ra8835_fill_rect() with a height of 1.
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] x         leftmost column
+ * @param[in] y         row
+ * @param[in] w         length in pixels
+ * @param[in] op        what to do with the pixels
+ */
+void ra8835_hline(const ra8835_t *dev, int x, int y, int w, ra8835_pixel_op_t op);
+
+/**
+ * @brief   Draw a vertical line on the graphics layer
+ *
+ * Same as ra8835_fill_rect() with a width of 1.
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] x         column
+ * @param[in] y         top row
+ * @param[in] h         length in pixels
+ * @param[in] op        what to do with the pixels
+ */
+void ra8835_vline(const ra8835_t *dev, int x, int y, int h, ra8835_pixel_op_t op);
+
+/**
+ * @brief   Fill a rectangle on the graphics layer
+ *
+ * Partial bytes at the left and right edge are read-modify-written as
+ * column runs, full bytes in between are written without reading back,
+ * one burst per row, or a single burst if the rectangle spans whole rows.
+ * Clipped to the screen.
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] x         leftmost column
+ * @param[in] y         top row
+ * @param[in] w         width in pixels
+ * @param[in] h         height in pixels
+ * @param[in] op        what to do with the pixels
+ */
+void ra8835_fill_rect(const ra8835_t *dev, int x, int y, int w, int h,
+                      ra8835_pixel_op_t op);
+
+/**
+ * @brief   Draw the outline of a rectangle on the graphics layer
+ *
+ * Corners are only hit once, so RA8835_PIXEL_TOGGLE works as expected.
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] x         leftmost column
+ * @param[in] y         top row
+ * @param[in] w         width in pixels
+ * @param[in] h         height in pixels
+ * @param[in] op        what to do with the pixels
+ */
+void ra8835_rect(const ra8835_t *dev, int x, int y, int w, int h,
+                 ra8835_pixel_op_t op);
+
+/**
+ * @brief   Copy a 1 bit per pixel image into a rectangle of the graphics layer
+ *
+ * Pixels around the rectangle are preserved. Display bytes fully covered
+ * by the image are written with one CSRW and one MWRITE burst per row,
+ * shifted on the fly if @p x is not a multiple of 8; partly covered bytes
+ * at the left and right edge are read-modify-written as column runs. With
+ * a shadow attached this only touches RAM, see ra8835_flush(). Parts off
+ * screen are clipped.
+ *
+ * @param[in] dev       device descriptor
+ * @param[in] x         column of the left edge
+ * @param[in] y         row of the top edge
+ * @param[in] w         width in pixels
+ * @param[in] h         height in pixels
+ * @param[in] src       image, MSB is the leftmost pixel
+ * @param[in] stride    bytes from one image row to the next, at least
+ *                      (@p w + 7) / 8
+ */
+void ra8835_blit(const ra8835_t *dev, int x, int y, int w, int h,
+                 const uint8_t *src, size_t stride);
+
+/**
+ * @brief   Select the graphics page the drawing functions go to
+ *
+ * The @p pages of a descriptor are stacked in display RAM, page n holding
+ * graphics lines n * rows to (n + 1) * rows - 1. Drawing to a page that is
+ * not shown and then showing it with ra8835_show_page() avoids tearing.
+ * With a shadow attached the whole shadow is marked dirty, so the next
+ * ra8835_flush() writes the full picture to the new page.
+ *
+ * @param[in,out] dev   device descriptor
+ * @param[in] page      page number, below @p pages
+ *
+ * @return  0 on success
+ * @return  -EINVAL if there is no such page
+ */
+int ra8835_draw_page(ra8835_t *dev, unsigned page);
+
+/**
+ * @brief   Show a graphics page
+ *
+ * Same as ra8835_scroll() to the first line of @p page, costs one SCROLL
+ * command.
+ *
+ * @param[in,out] dev   device descriptor
+ * @param[in] page      page number, below @p pages
+ *
+ * @return  0 on success
+ * @return  -EINVAL if there is no such page
+ */
+int ra8835_show_page(ra8835_t *dev, unsigned page);
+
+/**
+ * @brief   Scroll the graphics layer vertically
+ *
+ * Moves the start of the shown graphics to @p line of the stacked pages by
+ * rewriting the SAD2 start address, nothing is redrawn. The text layer
+ * stays where it is.
+ *
+ * @param[in,out] dev   device descriptor
+ * @param[in] line      first line to show, at most (pages - 1) * rows
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p line is out of range
+ */
+int ra8835_scroll(ra8835_t *dev, unsigned line);
+
+/**
+ * @brief   Scroll the display horizontally
+ *
+ * Needs a @p width larger than @p cols, the layers are then laid out that
+ * wide in display RAM and the drawing functions accept columns up to
+ * @p width. The screen shows @p cols of them starting at @p x: whole bytes
+ * are stepped by moving the SAD start addresses, the remaining 0-7 pixels
+ * by HDOT_SCR. A step within the same byte costs 2 bus bytes, crossing a
+ * byte boundary another 11. Text and graphics move together, the
+ * controller cannot shift one layer by single pixels without the other.
+ *
+ * @param[in,out] dev   device descriptor
+ * @param[in] x         first column to show, at most @p width - @p cols
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p x is out of range
+ */
+int ra8835_hscroll(ra8835_t *dev, unsigned x);
+
+/**
+ * @brief   Select the layer the graphics drawing functions go to
+ *
+ * Only useful with @p layers set to 3: layer 1 then is a graphics plane
+ * instead of text, and layer 3 is a third plane ORed over the other two.
+ * A static background can be uploaded to layer 1 once while only the
+ * moving parts are redrawn on a plane of their own. The text functions
+ * must not be used in that mode. Layer 2 is the default and the only one
+ * with pages.
+ *
+ * With a shadow attached, pending changes are flushed first and the
+ * shadow is then read back from the new layer. That read is a whole
+ * plane, 9600 bytes on a 320x240 panel, for every switch, which is more
+ * than a shadow saves in a frame. Shadowed users should stay on one
+ * plane and draw the others before attaching the shadow, or use a
+ * @ref ra8835_dl_t instead, which switches planes for free. Selecting the
+ * layer already drawn to costs nothing.
+ *
+ * @param[in,out] dev   device descriptor
+ * @param[in] layer     1, 2 or 3
+ *
+ * @return  0 on success
+ * @return  -EINVAL if there is no such graphics layer
+ */
+int ra8835_draw_layer(ra8835_t *dev, unsigned layer);
+
+/**
+ * @brief   Change how the layers are combined on screen
+ *
+ * Costs one OVLAY command, nothing is redrawn. With RA8835_MIX_XOR a box
+ * filled on the graphics layer inverts the text below it, e.g. to
+ * highlight a menu entry without touching the text.
+ *
+ * @param[in,out] dev   device descriptor
+ * @param[in] mix       new composition
+ */
+void ra8835_set_mix(ra8835_t *dev, ra8835_mix_t mix);
+
+/**
+ * @brief   Make sure a bitmap is held in display RAM
+ *
+ * Uploads @p src into the free region of the memory map unless it is
+ * there already, evicting the least recently used bitmaps as needed.
+ * Bitmaps are told apart by address and size only. When the content
+ * behind @p src changes, e.g. a RAM buffer that is rendered into again,
+ * call ra8835_sprite_forget() first or the old pixels are used.
+ *
+ * @param[in] dev       device descriptor
+ * @param[in,out] cache sprite cache
+ * @param[in] src       bitmap, also the key it is found by
+ * @param[in] size      length of @p src in bytes
+ *
+ * @return  slot index in @p cache
+ * @return  -ENOMEM if it does not fit even into an empty cache
+ */
+int ra8835_sprite_load(const ra8835_t *dev, ra8835_sprite_cache_t *cache,
+                       const uint8_t *src, size_t size);
+
+/**
+ * @brief   Draw a cached bitmap onto the graphics layer
+ *
+ * Like ra8835_blit() with a stride of (@p w + 7) / 8. On the first use
+ * the bitmap is uploaded to the cache and drawn from @p src, later on it
+ * is read back from display RAM through MREAD and @p src is only used as
+ * the key. The controller has no copy within display RAM, so a hit moves
+ * each byte twice over the bus; it pays off when @p src is expensive to
+ * produce or fetch, not for bitmaps in internal flash. As with
+ * ra8835_sprite_load(), a buffer that is reused for other pixels has to
+ * be passed to ra8835_sprite_forget() in between.
+ *
+ * @param[in] dev       device descriptor
+ * @param[in,out] cache sprite cache
+ * @param[in] x         column of the left edge
+ * @param[in] y         row of the top edge
+ * @param[in] w         width in pixels
+ * @param[in] h         height in pixels
+ * @param[in] src       bitmap, MSB is the leftmost pixel
+ *
+ * @return  0 on success
+ * @return  -ENOMEM if it does not fit even into an empty cache
+ */
+int ra8835_sprite_draw(const ra8835_t *dev, ra8835_sprite_cache_t *cache,
+                       int x, int y, int w, int h, const uint8_t *src);
+
+/**
+ * @brief   Drop a bitmap from the cache
+ *
+ * The next ra8835_sprite_load() or ra8835_sprite_draw() of @p src uploads
+ * it again. Needed whenever the content behind @p src changes. Display
+ * RAM is not touched.
+ *
+ * @param[in,out] cache sprite cache
+ * @param[in] src       bitmap as passed on loading
+ *
+ * @return  0 on success, also if @p src was not cached
+ * @return  -EBUSY if @p src is the strip currently shown, hide it with
+ *          ra8835_sprite_strip() first
+ */
+int ra8835_sprite_forget(ra8835_sprite_cache_t *cache, const uint8_t *src);
+
+/**
+ * @brief   Show a full width bitmap over the bottom lines of the graphics
+ *          layer
+ *
+ * The bitmap is cached like with ra8835_sprite_load() and then shown by
+ * pointing the screen block 4 start address (SAD4) at it and ending block
+ * 2 early, so nothing is copied: switching between cached strips costs
+ * one SCROLL command. The strip stays pinned in the cache until another
+ * one is shown or @p lines is 0.
+ *
+ * @param[in,out] dev   device descriptor
+ * @param[in,out] cache sprite cache
+ * @param[in] src       @p lines lines of width / 8 bytes each
+ * @param[in] lines     height of the strip, 0 to show the graphics layer
+ *                      only
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p lines is not below the screen height
+ * @return  -ENOMEM if it does not fit even into an empty cache
+ */
+int ra8835_sprite_strip(ra8835_t *dev, ra8835_sprite_cache_t *cache,
+                        const uint8_t *src, unsigned lines);
+
+/**
+ * @brief   Send the parts of the graphics shadow changed since the last
+ *          flush to the display, or replay the display list
+ *
+ * Each dirty span costs one CSRW and one MWRITE burst, spans that continue
+ * in display RAM share a burst. Does nothing without a shadow or display
+ * list.
+ *
+ * @param[in] dev       device descriptor
+ */
+void ra8835_flush(const ra8835_t *dev);
+
+/**
+ * @brief   Called when an asynchronous transfer is done, in interrupt
+ *          context unless the transfer was driven by hand
+ */
+typedef void (*ra8835_async_cb_t)(void *arg);
+
+/**
+ * @brief   One display RAM write of an asynchronous transfer
+ */
+typedef struct {
+    const uint8_t *buf;         /**< bytes to write, must stay valid */
+    size_t len;                 /**< number of bytes */
+    uint16_t addr;              /**< display RAM address of the first */
+} ra8835_xfer_t;
+
+/**
+ * @brief   Queue of display RAM writes sent in the background
+ *
+ * A timer callback sends @ref CONFIG_RA8835_ASYNC_CHUNK bytes every
+ * @ref CONFIG_RA8835_ASYNC_PERIOD_US, the CPU is free in between. Nothing
+ * else may use the bus of the same display until the transfer is done.
+ * Set up with ra8835_async_init().
+ */
+typedef struct {
+    const ra8835_t *dev;        /**< display written to */
+    ra8835_xfer_t xfer[CONFIG_RA8835_ASYNC_QUEUE]; /**< queued writes */
+    uint8_t num;                /**< number of queued writes */
+    uint8_t cur;                /**< write in progress */
+    size_t pos;                 /**< bytes of it already sent */
+    volatile uint8_t busy;      /**< transfer in progress */
+    ra8835_async_cb_t cb;       /**< completion callback, may be NULL */
+    void *arg;                  /**< argument of @p cb */
+    xtimer_t timer;             /**< drives the chunks */
+    mutex_t done;               /**< unlocked when a transfer ends */
+} ra8835_async_t;
+
+/**
+ * @brief   Set up an empty transfer queue for @p dev
+ *
+ * @param[out] as       queue
+ * @param[in]  dev      device descriptor
+ */
+void ra8835_async_init(ra8835_async_t *as, const ra8835_t *dev);
+
+/**
+ * @brief   Add a display RAM write to the queue
+ *
+ * Bytes go out as they are, with the cursor moving right, so images have
+ * to be in the panel's own orientation, see ra8835_write_img_native().
+ *
+ * @param[in,out] as    queue
+ * @param[in] addr      display RAM address of the first byte
+ * @param[in] buf       bytes to write, must stay valid until done
+ * @param[in] len       number of bytes
+ *
+ * @return  0 on success
+ * @return  -EBUSY if a transfer is in progress
+ * @return  -ENOMEM if the queue is full
+ * @return  -EINVAL if @p len is 0
+ */
+int ra8835_async_queue(ra8835_async_t *as, uint16_t addr, const uint8_t *buf,
+                       size_t len);
+
+/**
+ * @brief   Start sending the queue in the background
+ *
+ * The first chunk is sent right away. When the last one is out the queue
+ * is emptied and @p cb is called. The transfer counts as done by then,
+ * so @p cb may queue and start the next one, e.g. to chain frames.
+ *
+ * With @ref CONFIG_RA8835_SIM no timer is used, the transfer advances by
+ * ra8835_async_step() or ra8835_async_wait() only.
+ *
+ * @param[in,out] as    queue
+ * @param[in] cb        completion callback, may be NULL
+ * @param[in] arg       argument of @p cb
+ *
+ * @return  0 on success
+ * @return  -EBUSY if a transfer is in progress
+ */
+int ra8835_async_start(ra8835_async_t *as, ra8835_async_cb_t cb, void *arg);
+
+/**
+ * @brief   Send the next chunk of a transfer
+ *
+ * This is what the timer calls, it may also be called by hand to push a
+ * transfer along.
+ *
+ * @param[in,out] as    queue
+ *
+ * @return  1 if there is more to send
+ * @return  0 if the transfer is done, or none was running
+ */
+int ra8835_async_step(ra8835_async_t *as);
+
+/**
+ * @brief   Wait for a transfer to finish
+ *
+ * Returns once no transfer is in progress. When the callback starts the
+ * next transfer, that is the end of the chain. Thread context only.
+ *
+ * @param[in,out] as    queue
+ */
+void ra8835_async_wait(ra8835_async_t *as);
+
+/**
+ * @brief   Check whether a transfer is in progress
+ *
+ * @param[in] as        queue
+ *
+ * @return  1 while busy, 0 otherwise
+ */
+static inline int ra8835_async_busy(const ra8835_async_t *as)
+{
+    return as->busy;
+}
+
+/**
+ * @brief   Write a full screen image in the background
+ *
+ * Same as ra8835_write_img_native(), but returns after the first chunk.
+ * The image goes straight to display RAM, a shadow is not updated.
+ *
+ * @param[in,out] as    queue, must be empty
+ * @param[in] img       rows * width / 8 bytes, must stay valid until done
+ * @param[in] cb        completion callback, may be NULL
+ * @param[in] arg       argument of @p cb
+ *
+ * @return  0 on success
+ * @return  -EBUSY if a transfer is in progress
+ */
+int ra8835_write_img_async(ra8835_async_t *as, const uint8_t img[],
+                           ra8835_async_cb_t cb, void *arg);
+
+/**
+ * @brief   Print the counters of @p dev, see @ref CONFIG_RA8835_STATS
+ *
+ * Does nothing if the statistics are compiled out or none are attached.
+ *
+ * @param[in] dev       device descriptor
+ */
+#if CONFIG_RA8835_STATS || defined(DOXYGEN)
+void ra8835_stats_dump(const ra8835_t *dev);
+#else
+static inline void ra8835_stats_dump(const ra8835_t *dev)
+{
+    (void)dev;
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RA8835_H */
+/** @} */
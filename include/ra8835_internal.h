@@ -19,12 +19,17 @@
 
 #include "periph/gpio.h"
 
+#include "ra8835.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 /* Defined at ra8835_font.c */
 extern const uint8_t ra8835_font[];
+#if CONFIG_RA8835_FLIPPED_FONT
+extern const uint8_t ra8835_font_flipped[];
+#endif
 
 /**
  * @name    RA8835 LCD commands
@@ -49,11 +54,50 @@ extern const uint8_t ra8835_font[];
 #define RA8835_MREAD                   (0x43)
 /** @} */
 
+/**
+ * @brief   Size of the display RAM
+ */
+#define RA8835_VRAM_SIZE               (0x8000U)
+
+/**
+ * @brief   Where the character generator RAM starts, graphics pages must
+ *          end below unless there is no text layer
+ */
+#define RA8835_CGRAM_ADDR              (0x7000U)
+
+/**
+ * @brief   Display bytes buffered for one read-modify-write run
+ */
+#define RA8835_RUN_MAX                 (32U)
+
 /**
  * @name    RA8835 LCD timings
  * @{
  */
 #define RA8835_RESET_PULSE             (2U)
+/** @brief Oscillator period tC in ns */
+#define RA8835_T_C_NS                  (1000000000UL / CONFIG_RA8835_FOSC_HZ)
+/** @brief ~WR low pulse width (tCC) in ns */
+#define RA8835_T_CC_NS                 (120U)
+/** @brief Data setup before the rising edge of ~WR (tDS8) in ns */
+#define RA8835_T_DS8_NS                (120U)
+/**
+ * @brief System cycle time (tCYC8) in ns, from falling edge to falling edge
+ *        of ~WR. Two oscillator periods on top of the strobe, plus margin.
+ */
+#define RA8835_T_CYC8_NS               (2 * RA8835_T_C_NS + RA8835_T_CC_NS + 30U)
+/** @brief Data valid after the falling edge of ~RD (tACC8) in ns */
+#define RA8835_T_ACC8_NS               (100U)
+/** @brief How long ~WR is held low after the data lines are driven */
+#define RA8835_WR_LOW_NS               ((RA8835_T_CC_NS > RA8835_T_DS8_NS) ? \
+                                        RA8835_T_CC_NS : RA8835_T_DS8_NS)
+/** @brief How long ~WR is held high before the next cycle may start */
+#define RA8835_WR_HIGH_NS              (RA8835_T_CYC8_NS - RA8835_WR_LOW_NS)
+/** @brief How long ~RD is held low before the data lines are sampled */
+#define RA8835_RD_LOW_NS               ((RA8835_T_CC_NS > RA8835_T_ACC8_NS) ? \
+                                        RA8835_T_CC_NS : RA8835_T_ACC8_NS)
+/** @brief How long ~RD is held high before the next cycle may start */
+#define RA8835_RD_HIGH_NS              (RA8835_T_CYC8_NS - RA8835_RD_LOW_NS)
 /**@}*/
 
 #ifdef __cplusplus
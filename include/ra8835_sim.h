@@ -0,0 +1,218 @@
+/**
+ * @ingroup     drivers_ra8835
+ *
+ * @{
+ * @file
+ * @brief       Host-side bus simulator for the RA8835 graphic LCD
+ *
+ * With @ref CONFIG_RA8835_SIM set the driver does not touch any GPIO.
+ * Every line access goes to a software model of the controller instead,
+ * which latches bytes on the rising edge of ~WR like the real part does,
+ * decodes the command stream into a 32 KB display RAM and keeps a cost
+ * account of the traffic. The account charges each line access and each
+ * delay with a configurable duration, so two versions of a drawing routine
+ * can be compared on a plain Linux box. Strobes are also checked against
+ * the datasheet timings in ra8835_internal.h, so the throughput figure
+ * only counts when timing_violations stays at zero:
+ *
+ *     ra8835_sim_stats_t before, after;
+ *     ra8835_sim_get_stats(&before);
+ *     ra8835_write_img(&dev, picture);
+ *     ra8835_sim_get_stats(&after);
+ *     printf("%" PRIu32 " bytes, %" PRIu64 " ns\n",
+ *            after.data_bytes - before.data_bytes,
+ *            after.time_ns - before.time_ns);
+ *
+ * @author      Alexander Podshivalov <a_podshivalov@mail.ru>
+ */
+#ifndef RA8835_SIM_H
+#define RA8835_SIM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ra8835.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name    Simulator cost model
+ * @{
+ */
+/**
+ * @brief   Simulated duration of a single GPIO line access in ns
+ *
+ * Roughly a call to gpio_set() on a 32 MHz Cortex-M.
+ */
+#ifndef CONFIG_RA8835_SIM_GPIO_NS
+#define CONFIG_RA8835_SIM_GPIO_NS      (400U)
+#endif
+
+/**
+ * @brief   Simulated duration of writing all data lines through a port
+ *          mapped bus in ns
+ */
+#ifndef CONFIG_RA8835_SIM_PORT_NS
+#define CONFIG_RA8835_SIM_PORT_NS      (250U)
+#endif
+
+/**
+ * @brief   Fixed overhead of a timer based sleep in ns, added to the
+ *          requested duration
+ */
+#ifndef CONFIG_RA8835_SIM_SLEEP_OVERHEAD_NS
+#define CONFIG_RA8835_SIM_SLEEP_OVERHEAD_NS (2000U)
+#endif
+/** @} */
+
+/**
+ * @brief   Size of the emulated display RAM
+ */
+#define RA8835_SIM_VRAM_SIZE           (0x8000U)
+
+/**
+ * @brief   Layers that can be rendered
+ */
+typedef enum {
+    RA8835_SIM_LAYER1,          /**< screen blocks 1 and 3 (text at init) */
+    RA8835_SIM_LAYER2,          /**< screen blocks 2 and 4 (graphics) */
+    RA8835_SIM_LAYER3,          /**< screen block 3 in three-layer mode */
+    RA8835_SIM_COMPOSITE,       /**< what the panel shows */
+} ra8835_sim_layer_t;
+
+/**
+ * @brief   Traffic and time accounting, counted since the last reset
+ */
+typedef struct {
+    uint64_t time_ns;           /**< simulated wall time */
+    uint32_t gpio_ops;          /**< GPIO line accesses */
+    uint32_t bus_cycles;        /**< strobes accepted by the controller */
+    uint32_t cmd_bytes;         /**< command bytes written */
+    uint32_t data_bytes;        /**< parameter and display bytes written */
+    uint32_t read_bytes;        /**< status, cursor and display bytes read */
+    uint32_t timing_violations; /**< strobes shorter than tCC, data set up
+                                     later than tDS8, sampled earlier than
+                                     tACC8 or cycles shorter than tCYC8 */
+} ra8835_sim_stats_t;
+
+/**
+ * @brief   Bind the model to the lines of @p dev and reset the controller
+ *
+ * Called by ra8835_init(). Display RAM is left as it is, like on a real
+ * panel that stays powered across an MCU reset.
+ *
+ * @param[in] dev       device descriptor
+ */
+void ra8835_sim_attach(const ra8835_t *dev);
+
+/**
+ * @brief   Drive one of the bus lines
+ *
+ * @param[in] pin       line, one of the pins of the attached descriptor
+ * @param[in] value     new level
+ */
+void ra8835_sim_pin_write(gpio_t pin, int value);
+
+/**
+ * @brief   Switch a bus line between input and output
+ *
+ * Only accounted for, the model does not care about line direction.
+ *
+ * @param[in] pin       line, one of the pins of the attached descriptor
+ * @param[in] mode      new direction
+ */
+void ra8835_sim_pin_init(gpio_t pin, gpio_mode_t mode);
+
+/**
+ * @brief   Sample one of the data lines
+ *
+ * @param[in] pin       one of the data pins of the attached descriptor
+ *
+ * @return  level the controller drives while ~RD is low, 0 otherwise
+ */
+int ra8835_sim_pin_read(gpio_t pin);
+
+/**
+ * @brief   Sample all data lines at once, as a port mapped bus does
+ *
+ * @return  byte the controller drives while ~RD is low, 0 otherwise
+ */
+uint8_t ra8835_sim_port_read(void);
+
+/**
+ * @brief   Drive all data lines at once, as a port mapped bus does
+ *
+ * @param[in] value     byte to put on D0..D7
+ */
+void ra8835_sim_port_write(uint8_t value);
+
+/**
+ * @brief   Account for a busy-wait
+ *
+ * @param[in] ns        duration in nanoseconds
+ */
+void ra8835_sim_delay_ns(uint32_t ns);
+
+/**
+ * @brief   Account for a timer based sleep
+ *
+ * @param[in] us        requested duration in microseconds
+ */
+void ra8835_sim_sleep_us(uint32_t us);
+
+/**
+ * @brief   Read the traffic and time accounting
+ *
+ * @param[out] stats    destination
+ */
+void ra8835_sim_get_stats(ra8835_sim_stats_t *stats);
+
+/**
+ * @brief   Zero the traffic and time accounting
+ */
+void ra8835_sim_reset_stats(void);
+
+/**
+ * @brief   Raw access to the emulated display RAM
+ *
+ * @return  @ref RA8835_SIM_VRAM_SIZE bytes
+ */
+const uint8_t *ra8835_sim_vram(void);
+
+/**
+ * @brief   Render a layer into a 1 bit per pixel buffer
+ *
+ * Geometry is taken from the last SYSTEM_SET, layout from SCROLL, OVLAY,
+ * HDOT_SCR and DISPLAY_ON/OFF. Text layers are drawn through the glyphs
+ * found at CGRAM_ADR. Rows are packed, MSB is the leftmost pixel and a set
+ * bit is a dark pixel.
+ *
+ * @param[in]  layer    layer to render
+ * @param[out] buf      destination
+ * @param[in]  size     size of @p buf in bytes
+ *
+ * @return  number of bytes rendered
+ * @return  -ENOBUFS if @p buf is too small for the screen
+ */
+int ra8835_sim_render(ra8835_sim_layer_t layer, uint8_t *buf, size_t size);
+
+/**
+ * @brief   Write a layer to a binary (P4) PBM file
+ *
+ * @param[in] path      file name
+ * @param[in] layer     layer to dump
+ *
+ * @return  0 on success
+ * @return  -ENOBUFS if the screen is larger than the simulator supports
+ * @return  -EIO if the file could not be written
+ */
+int ra8835_sim_dump_pbm(const char *path, ra8835_sim_layer_t layer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RA8835_SIM_H */
+/** @} */
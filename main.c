@@ -7,6 +7,12 @@
 
 #include "ra8835.h"
 
+/* Graphics are drawn here first, only changes go to the display */
+static ra8835_fb_t the_fb;
+
+/* Lets the driver skip commands that would change nothing */
+static ra8835_ctl_t the_ctl;
+
 static ra8835_t the_display = {
     .cols = 320,
     .rows = 240,
@@ -25,7 +31,9 @@ static ra8835_t the_display = {
         UNWD_GPIO_4,
         UNWD_GPIO_1
     },
-    .upside_down = 0
+    .upside_down = 0,
+    .fb = &the_fb,
+    .ctl = &the_ctl
 };
 
 /* Use https://www.skaarhoj.com/FreeStuff/GraphicDisplayImageConverter.php to convert */
@@ -282,6 +290,7 @@ int main(void) {
     while(1){
         printf("start frame, lptimer_now = %lu\n", lptimer_now().ticks32);
         ra8835_write_img(&the_display, picture);
+        ra8835_flush(&the_display);
         
         ra8835_text_set_cursor(&the_display, 6, 13);
         ra8835_text_print(&the_display, "!");
@@ -12,6 +12,10 @@
  */
 
 #include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
 #include <string.h>
 
 #include "log.h"
@@ -26,6 +30,17 @@
 #include "ra8835_internal.h"
 #include <stdlib.h> 
 
+#if CONFIG_RA8835_SIM
+#include "ra8835_sim.h"
+#else
+#include "periph_conf.h"
+
+/* Datasheet nanoseconds to iterations of _spin(), rounded up */
+#define RA8835_NS_TO_LOOPS(ns) \
+    (((ns) * (CLOCK_CORECLOCK / 1000000UL) + 1000UL * CONFIG_RA8835_DELAY_LOOP_CYCLES - 1) / \
+     (1000UL * CONFIG_RA8835_DELAY_LOOP_CYCLES))
+#endif
+
 /* Need this for upside-down graphic displays */
 static const char reverse[256] = {
   0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0, 
@@ -46,360 +61,2513 @@ static const char reverse[256] = {
   0x0F, 0x8F, 0x4F, 0xCF, 0x2F, 0xAF, 0x6F, 0xEF, 0x1F, 0x9F, 0x5F, 0xDF, 0x3F, 0xBF, 0x7F, 0xFF
 };
 
-static void _send(const ra8835_t *dev, uint8_t value, ra8835_state_t state);
+/* Line access goes either to GPIO or to the host-side bus simulator */
+static inline void _pin_init(gpio_t pin, gpio_mode_t mode){
+#if CONFIG_RA8835_SIM
+    ra8835_sim_pin_init(pin, mode);
+#else
+    gpio_init(pin, mode);
+#endif
+}
 
-static void _send(const ra8835_t *dev, uint8_t value, ra8835_state_t state){
-    gpio_set(dev->rd);
-    gpio_set(dev->wr);
-    if( state == RA8835_DATA ){
-        gpio_clear(dev->a0);
-    } else {
-        gpio_set(dev->a0);
+static inline int _pin_read(gpio_t pin){
+#if CONFIG_RA8835_SIM
+    return ra8835_sim_pin_read(pin);
+#else
+    return gpio_read(pin);
+#endif
+}
+
+static inline void _pin_set(gpio_t pin){
+#if CONFIG_RA8835_SIM
+    ra8835_sim_pin_write(pin, 1);
+#else
+    gpio_set(pin);
+#endif
+}
+
+static inline void _pin_clear(gpio_t pin){
+#if CONFIG_RA8835_SIM
+    ra8835_sim_pin_write(pin, 0);
+#else
+    gpio_clear(pin);
+#endif
+}
+
+#if !CONFIG_RA8835_SIM
+static inline void _spin(uint32_t loops){
+    while( loops-- ){
+        __asm__ volatile ("");
+    }
+}
+#endif
+
+/* Bus timing delays are far below the timer resolution, so busy-wait.
+   With a constant argument the loop count folds at compile time */
+static inline void _delay_ns(uint32_t ns){
+#if CONFIG_RA8835_SIM
+    ra8835_sim_delay_ns(ns);
+#else
+    _spin(RA8835_NS_TO_LOOPS(ns));
+#endif
+}
+
+static inline void _sleep_us(uint32_t us){
+#if CONFIG_RA8835_SIM
+    ra8835_sim_sleep_us(us);
+#else
+    xtimer_usleep(us);
+#endif
+}
+
+/* Counters, see CONFIG_RA8835_STATS. Without it these compile to nothing */
+static inline uint32_t _now_us(void){
+#if CONFIG_RA8835_SIM
+    ra8835_sim_stats_t sim;
+    
+    ra8835_sim_get_stats(&sim);
+    return sim.time_ns / 1000U;
+#else
+    return xtimer_now_usec();
+#endif
+}
+
+static inline void _stats_bytes(const ra8835_t *dev, size_t n){
+#if CONFIG_RA8835_STATS
+    if( dev->stats ){
+        dev->stats->bytes += n;
+    }
+#else
+    (void)dev;
+    (void)n;
+#endif
+}
+
+static inline void _stats_cmd(const ra8835_t *dev, uint8_t cmd){
+#if CONFIG_RA8835_STATS
+    if( dev->stats ){
+        dev->stats->cmds++;
+        if( cmd == RA8835_CSRW ){
+            dev->stats->cursor_moves++;
+        }
+    }
+#else
+    (void)dev;
+    (void)cmd;
+#endif
+}
+
+static inline void _stats_reads(const ra8835_t *dev, size_t n){
+#if CONFIG_RA8835_STATS
+    if( dev->stats ){
+        dev->stats->reads += n;
+    }
+#else
+    (void)dev;
+    (void)n;
+#endif
+}
+
+static inline uint32_t _stats_start(const ra8835_t *dev){
+#if CONFIG_RA8835_STATS
+    if( dev->stats ){
+        return _now_us();
+    }
+#else
+    (void)dev;
+#endif
+    return 0;
+}
+
+static inline void _stats_stop(const ra8835_t *dev, ra8835_stats_id_t id, uint32_t start){
+#if CONFIG_RA8835_STATS
+    ra8835_stats_call_t *call;
+    uint32_t us;
+    unsigned bin = 0;
+    
+    if( dev->stats == NULL ){
+        return;
+    }
+    call = &dev->stats->call[id];
+    us = _now_us() - start;
+    if( (call->count == 0) || (us < call->min_us) ){
+        call->min_us = us;
+    }
+    if( us > call->max_us ){
+        call->max_us = us;
+    }
+    call->count++;
+    call->total_us += us;
+    while( (us >>= 1) && (bin < CONFIG_RA8835_STATS_BINS - 1) ){
+        bin++;
+    }
+    call->hist[bin]++;
+#else
+    (void)dev;
+    (void)id;
+    (void)start;
+#endif
+}
+
+/* Put a byte on D0..D7 */
+static inline void _data_out(const ra8835_t *dev, uint8_t value){
+    if( dev->bus == RA8835_BUS_PORT ){
+#if CONFIG_RA8835_SIM
+        ra8835_sim_port_write(value);
+#elif defined(MODULE_PERIPH_GPIO_LL)
+        uword_t set = dev->port.lo[value & 0x0F] | dev->port.hi[value >> 4];
+        
+        /* ~WR is low, the byte is only latched on its rising edge */
+        gpio_ll_clear(dev->port.port, dev->port.mask & ~set);
+        gpio_ll_set(dev->port.port, set);
+#endif
+        return;
     }
-    gpio_clear(dev->cs);
-    gpio_clear(dev->wr);
     
-    /* like in HD44870 driver
-       not a very brilliant idea to bit-
-       band a large graphic lcd, so
-       TODO: use something better */
-    xtimer_usleep(1);
     for (unsigned i = 0; i < 8; ++i) {
         if ((value >> i) & 0x01) {
-            gpio_set(dev->data[i]);
+            _pin_set(dev->data[i]);
         }
         else {
-            gpio_clear(dev->data[i]);
+            _pin_clear(dev->data[i]);
         }
     }
-    xtimer_usleep(1);
-    
-    gpio_set(dev->wr);
-    gpio_set(dev->cs);
 }
 
-int ra8835_init(ra8835_t *dev){
-    uint16_t addr;
+/* Sample D0..D7 */
+static inline uint8_t _data_in(const ra8835_t *dev){
+    uint8_t value = 0;
     
-    gpio_init(dev->wr, GPIO_OUT); // ~WR
-    gpio_init(dev->rd, GPIO_OUT); // ~RD
-    gpio_init(dev->cs, GPIO_OUT); // ~CS
-    gpio_init(dev->a0, GPIO_OUT); // A0
-    gpio_init(dev->rst, GPIO_OUT);// ~RST
+    if( dev->bus == RA8835_BUS_PORT ){
+#if CONFIG_RA8835_SIM
+        return ra8835_sim_port_read();
+#elif defined(MODULE_PERIPH_GPIO_LL)
+        uword_t in = gpio_ll_read(dev->port.port);
+        
+        /* The single bit entries of the nibble tables are the line masks */
+        for (unsigned i = 0; i < 4; ++i) {
+            if (in & dev->port.lo[1 << i]) {
+                value |= 0x01 << i;
+            }
+            if (in & dev->port.hi[1 << i]) {
+                value |= 0x10 << i;
+            }
+        }
+        return value;
+#endif
+    }
     
+    for (unsigned i = 0; i < 8; ++i) {
+        if (_pin_read(dev->data[i])) {
+            value |= 0x01 << i;
+        }
+    }
+    return value;
+}
+
+/* Turn D0..D7 around, reads are rare enough to just reconfigure the pins */
+static void _data_dir(const ra8835_t *dev, gpio_mode_t mode){
     for( int i = 0; i < 8; i++){
-        gpio_init(dev->data[i], GPIO_OUT); // D[i]
+        _pin_init(dev->data[i], mode);
     }
+}
+
+/* Resolve dev->bus and build the port tables if the data lines allow it */
+static void _bus_setup(ra8835_t *dev){
+#if CONFIG_RA8835_SIM
+    /* Any backend can be simulated, but only use the port one on request */
+    if( dev->bus == RA8835_BUS_AUTO ){
+        dev->bus = RA8835_BUS_PIN;
+    }
+#elif defined(MODULE_PERIPH_GPIO_LL)
+    gpio_port_t port = gpio_get_port(dev->data[0]);
     
-    /* These lines are default high */
-    gpio_set(dev->wr);
-    gpio_set(dev->rd);
-    gpio_set(dev->cs);
-    gpio_set(dev->rst);
-    
-    /* Reset pulse */
-    xtimer_usleep(RA8835_RESET_PULSE);
-    gpio_clear(dev->rst);
-    xtimer_usleep(RA8835_RESET_PULSE);
-    gpio_set(dev->rst);
-    
-    _send(dev, RA8835_SYSTEM_SET, RA8835_CMD);//System Set
-    _send(dev, 0x31, RA8835_DATA);//P1: IV =1;M0=1, "External" CGRAM (or last ROM pages);M1=0,No D6 correction; W/S=0,Single-Panel; M2=0,8-Pixel character
-    _send(dev, 0x87, RA8835_DATA);//P2: WF=1,two-frame AC Driver;FX=8,Set Horizontal Character Size 8
-    _send(dev, 8-1, RA8835_DATA);//P3: Set Vertical Character Size
-    _send(dev, dev->cols/8 - 1, RA8835_DATA);//P4: CR,Bytes per display line
-    _send(dev, 0x2F, RA8835_DATA);//P5: T/CR,Line Length
-    _send(dev, dev->rows - 1, RA8835_DATA);//P6: L/F,Lines per frame
-    _send(dev, 0x28, RA8835_DATA);//P7: APL
-    _send(dev, 0x00, RA8835_DATA);//P8: APH,define the horizontal address range of the virtual address
-    
-    /* Memory allocation setup */
-    /* First layer (text), 8*8 characters, no scroll */
-    /* Starts at 0000 */
-    /* Second layer (graphics) */
-    /* Allocated after first layer */
-    addr = (dev->rows / 8) * (dev->cols / 8);
-    _send(dev, RA8835_SCROLL, RA8835_CMD);
-    _send(dev, 0x00, RA8835_DATA);//P1: SAD 1L
-    _send(dev, 0x00, RA8835_DATA);//P2: SAD 1H
-    _send(dev, dev->rows, RA8835_DATA);//P3: SL1
-    _send(dev, addr & 0xFF, RA8835_DATA); ;//P4: SAD 2L
-    _send(dev, (addr >> 8) & 0xFF, RA8835_DATA); //P5: SAD 2H
-    _send(dev, dev->rows, RA8835_DATA);//P6: SL2
-    _send(dev, 0x00, RA8835_DATA);//P7: SAD 3L
-    _send(dev, 0x00, RA8835_DATA);//P8: SAD 3H
-    _send(dev, 0x00, RA8835_DATA);//P9: SAD 4L
-    _send(dev, 0x00, RA8835_DATA);//P10: SAD 4H
+    if( dev->bus == RA8835_BUS_PIN ){
+        return;
+    }
+    for( unsigned i = 1; i < 8; i++){
+        if( gpio_get_port(dev->data[i]) != port ){
+            if( dev->bus == RA8835_BUS_PORT ){
+                LOG_WARNING("ra8835: data lines span several ports, using per-pin bus\n");
+            }
+            dev->bus = RA8835_BUS_PIN;
+            return;
+        }
+    }
     
-    /* Set Cursor Size and Shape */
-    _send(dev, RA8835_CSRFORM, RA8835_CMD);
-    _send(dev, 0x04, RA8835_DATA);//P1: Set Horizontal Size
-    _send(dev, 0x86, RA8835_DATA);//p2: Set Vertical Size; CM = 1 for gfx mode
-    
-    _send(dev, RA8835_HDOT_SCR, RA8835_CMD);//HDOT SCR
-    _send(dev, 0x00, RA8835_DATA);
-    
-    /* Selects layered screen composition and screen text/graphics mode */
-    _send(dev, RA8835_OVLAY, RA8835_CMD);
-    /* MX[1:0] = 00, OR mode, DM[1:2] = 00, text mode, OV = 0, two-layer mixed text and graphics */
-    _send(dev, 0x00, RA8835_DATA);
-    
-    /* Load a custom font with Cyrillic characters */
-    /* Also suitable for upside-down displays */
-    /* Set cursor adress to start of CG "ROM" */
-    /* See comments about A15 line in MELT displays, also tested with Winstar */
-    _send(dev, RA8835_CSRW, RA8835_CMD);
-    _send(dev, 0x00, RA8835_DATA);
-    _send(dev, 0x70, RA8835_DATA);
-    /* Set cursor autoincrement to move it properly */
-    _send(dev, RA8835_CSRDIR_RIGHT, RA8835_CMD);
-    /* Write character glyphs to LCD RAM */
-    _send(dev, RA8835_MWRITE, RA8835_CMD);
-    for(unsigned c = 0; c < 256; c++){
-        for(unsigned l = 0; l < 8; l++){
-            char line;
-            if( !dev->upside_down ){
-                line = ra8835_font[c*8 + l];
-            } else {
-                line = reverse[ra8835_font[c*8 + 7 - l]];
+    dev->bus = RA8835_BUS_PORT;
+    dev->port.port = port;
+    dev->port.mask = 0;
+    memset(dev->port.lo, 0, sizeof(dev->port.lo));
+    memset(dev->port.hi, 0, sizeof(dev->port.hi));
+    for( unsigned i = 0; i < 8; i++){
+        uword_t bit = (uword_t)1 << gpio_get_pin_num(dev->data[i]);
+        
+        dev->port.mask |= bit;
+        for( unsigned v = 0; v < 16; v++){
+            if( (i < 4) && (v & (1 << i)) ){
+                dev->port.lo[v] |= bit;
+            }
+            if( (i >= 4) && (v & (1 << (i - 4))) ){
+                dev->port.hi[v] |= bit;
             }
-            _send(dev, line, RA8835_DATA);
         }
     }
+#else
+    if( dev->bus == RA8835_BUS_PORT ){
+        LOG_WARNING("ra8835: port mapped bus needs periph_gpio_ll, using per-pin bus\n");
+    }
+    dev->bus = RA8835_BUS_PIN;
+#endif
+    DEBUG("ra8835: using %s bus\n", dev->bus == RA8835_BUS_PORT ? "port" : "per-pin");
+}
+
+/* Move the known cursor on by n bytes the way the controller does */
+static void _ctl_advance(ra8835_ctl_t *ctl, uint16_t n){
+    switch( ctl->dir ){
+        case RA8835_CSRDIR_RIGHT: ctl->cursor += n; break;
+        case RA8835_CSRDIR_LEFT:  ctl->cursor -= n; break;
+        case RA8835_CSRDIR_UP:    ctl->cursor -= n * ctl->ap; break;
+        case RA8835_CSRDIR_DOWN:  ctl->cursor += n * ctl->ap; break;
+        default:                  ctl->known = 0; break;
+    }
+}
+
+/* One write cycle, ~CS and A0 have to be in place already */
+static inline void _cycle(const ra8835_t *dev, uint8_t value){
+    _stats_bytes(dev, 1);
+    if( dev->ctl ){
+        dev->ctl->count++;
+    }
+    _pin_clear(dev->wr);
     
-    /* Also need to set CG RAM? */
-    _send(dev, RA8835_CGRAM_ADR, RA8835_CMD);
-    _send(dev, 0x00, RA8835_DATA);
-    _send(dev, 0x70, RA8835_DATA);
+    /* Hold ~WR low for tCC with the data set up for tDS8, then keep it
+       high for the rest of tCYC8 */
+    _data_out(dev, value);
+    _delay_ns(RA8835_WR_LOW_NS);
+    _pin_set(dev->wr);
+    _delay_ns(RA8835_WR_HIGH_NS);
+}
+
+/* Write cycles of one and the same byte. The data lines are driven once,
+   after that each cycle is just a ~WR strobe */
+static void _repeat(const ra8835_t *dev, uint8_t value, size_t n){
+    _stats_bytes(dev, n);
+    if( dev->ctl ){
+        dev->ctl->count += n;
+    }
+    _data_out(dev, value);
+    while( n-- ){
+        _pin_clear(dev->wr);
+        _delay_ns(RA8835_WR_LOW_NS);
+        _pin_set(dev->wr);
+        _delay_ns(RA8835_WR_HIGH_NS);
+    }
+}
+
+/* Select the chip and send a command, leaving A0 low for its parameters */
+static void _begin(const ra8835_t *dev, uint8_t cmd){
+    ra8835_ctl_t *ctl = dev->ctl;
     
-    ra8835_clear(dev);
-    ra8835_text_clear(dev);
+    /* Data goes to display RAM until the next command, so a write right
+       after another one needs no MWRITE */
+    if( ctl && (cmd == RA8835_MWRITE) && (ctl->cmd == RA8835_MWRITE) ){
+        _pin_clear(dev->a0);
+        _pin_clear(dev->cs);
+        ctl->count = 0;
+        return;
+    }
     
-    /* Display on */
-    _send(dev, RA8835_DISPLAY_ON, RA8835_CMD);
-    /* SAD3 blank, SAD2+SAD4 no flashing, SAD1 no flashing, cursor blank */
-    _send(dev, 0x14, RA8835_DATA);
+    _stats_cmd(dev, cmd);
+    _pin_set(dev->a0);
+    _pin_clear(dev->cs);
+    _cycle(dev, cmd);
+    _pin_clear(dev->a0);
     
-    return 0;
+    if( ctl == NULL ){
+        return;
+    }
+    ctl->cmd = cmd;
+    ctl->count = 0;
+    if( (cmd >= RA8835_CSRDIR_RIGHT) && (cmd <= RA8835_CSRDIR_DOWN) ){
+        ctl->dir = cmd;
+    } else if( cmd == RA8835_CSRW ){
+        /* Known again once all of the address is sent, see _set_cursor() */
+        ctl->known = 0;
+    }
 }
 
-void ra8835_text_clear(const ra8835_t *dev){
-    ra8835_text_home(dev);
+static inline void _end(const ra8835_t *dev){
+    ra8835_ctl_t *ctl = dev->ctl;
     
-    /* Write blanks to LCD RAM */
-    _send(dev, RA8835_MWRITE, RA8835_CMD);
-    for(int y = 0; y < dev->rows/8; y++){
-        for(int x = 0; x < dev->cols/8; x++){
-            _send(dev, ' ', RA8835_DATA);
-        }
+    _pin_set(dev->cs);
+    if( ctl && (ctl->cmd == RA8835_MWRITE) ){
+        _ctl_advance(ctl, ctl->count);
     }
 }
 
-void ra8835_text_home(const ra8835_t *dev){
-    ra8835_text_set_cursor(dev, 0, 0);
+/* Send a command and read back what it returns, A0 stays high for that */
+static void _read_burst(const ra8835_t *dev, uint8_t cmd, uint8_t *buf, size_t len){
+    ra8835_ctl_t *ctl = dev->ctl;
+    uint8_t *p = buf;
+    
+    _stats_cmd(dev, cmd);
+    _stats_reads(dev, len);
+    _pin_set(dev->a0);
+    _pin_clear(dev->cs);
+    _cycle(dev, cmd);
+    _data_dir(dev, GPIO_IN);
+    for(size_t i = 0; i < len; i++){
+        _pin_clear(dev->rd);
+        _delay_ns(RA8835_RD_LOW_NS);
+        *p++ = _data_in(dev);
+        _pin_set(dev->rd);
+        _delay_ns(RA8835_RD_HIGH_NS);
+    }
+    _data_dir(dev, GPIO_OUT);
+    _pin_set(dev->cs);
+    
+    if( ctl == NULL ){
+        return;
+    }
+    ctl->cmd = cmd;
+    if( cmd == RA8835_MREAD ){
+        _ctl_advance(ctl, len);
+    } else if( (cmd == RA8835_CSRR) && (len >= 2) ){
+        ctl->cursor = buf[0] | (buf[1] << 8);
+        ctl->known = 1;
+    }
 }
 
-void ra8835_text_set_cursor(const ra8835_t *dev, uint8_t col, uint8_t row){
-    uint16_t addr = row * (dev->cols / 8) + col;
+/* Command without parameters, a direction already in place is skipped */
+static void _cmd(const ra8835_t *dev, uint8_t cmd){
+    if( dev->ctl && (cmd == dev->ctl->dir) ){
+        return;
+    }
+    ra8835_write_burst(dev, cmd, NULL, 0);
+}
+
+static void _set_cursor(const ra8835_t *dev, uint16_t addr){
+    ra8835_ctl_t *ctl = dev->ctl;
+    const uint8_t p[] = { addr & 0xFF, (addr >> 8) & 0xFF };
     
-    if( dev->upside_down ){
-        addr = (dev->cols / 8) * (dev->rows / 8) - addr -1;
+    if( ctl && ctl->known && (ctl->cursor == addr) ){
+        return;
+    }
+    ra8835_write_burst(dev, RA8835_CSRW, p, sizeof(p));
+    if( ctl ){
+        ctl->cursor = addr;
+        ctl->known = 1;
     }
+}
+
+/* Where the cursor is, read back unless it is known */
+static uint16_t _get_cursor(const ra8835_t *dev){
+    uint8_t csr[2];
     
-    /* Set cursor adress to upper left corner */
-    _send(dev, RA8835_CSRW, RA8835_CMD);
-    _send(dev, addr & 0xFF, RA8835_DATA);
-    _send(dev, (addr >> 8) & 0xFF, RA8835_DATA);
+    if( dev->ctl && dev->ctl->known ){
+        return dev->ctl->cursor;
+    }
+    _read_burst(dev, RA8835_CSRR, csr, sizeof(csr));
+    return csr[0] | (csr[1] << 8);
+}
+
+void ra8835_write_burst(const ra8835_t *dev, uint8_t cmd, const uint8_t *buf, size_t len){
+    _begin(dev, cmd);
+    while( len-- ){
+        _cycle(dev, *buf++);
+    }
+    _end(dev);
+}
+
+void ra8835_fill_region(const ra8835_t *dev, uint16_t addr, size_t len, uint8_t value){
+    _set_cursor(dev, addr);
+    _cmd(dev, RA8835_CSRDIR_RIGHT);
+    _begin(dev, RA8835_MWRITE);
+    _repeat(dev, value, len);
+    _end(dev);
+}
+
+/* Graphics layer addressing. Offsets count bytes the way the application
+   sees the screen, upside-down panels get address and bit order mirrored */
+/* Width of the layers in display RAM, may be more than the screen shows */
+static inline int _cols(const ra8835_t *dev){
+    return dev->width ? dev->width : dev->cols;
+}
+
+/* Bytes per line in display RAM (AP) */
+static inline int _cpl(const ra8835_t *dev){
+    return _cols(dev) / 8;
+}
+
+static inline unsigned _gfx_pages(const ra8835_t *dev){
+    return dev->pages ? dev->pages : 1;
+}
+
+static inline int _three(const ra8835_t *dev){
+    return dev->layers == 3;
+}
+
+static inline uint16_t _map(const ra8835_t *dev, ra8835_map_id_t id){
+    return dev->map.region[id].addr;
+}
+
+/* Display address of byte offset of the page drawn to. Upside-down each
+   layer is turned around as a whole, so page 0 ends up at its top. */
+static inline uint16_t _gfx_addr(const ra8835_t *dev, size_t offset){
+    size_t page = dev->rows * _cpl(dev);
+    size_t size = page;
+    uint16_t start = _map(dev, RA8835_MAP_LAYER1);
     
-    /* Set cursor autoincrement to move it properly */
-    if( !dev->upside_down ){
-        _send(dev, RA8835_CSRDIR_RIGHT, RA8835_CMD);
-    } else {
-        _send(dev, RA8835_CSRDIR_LEFT, RA8835_CMD);
+    if( dev->layer == 3 ){
+        start = _map(dev, RA8835_MAP_LAYER3);
+    } else if( dev->layer != 1 ){
+        start = _map(dev, RA8835_MAP_LAYER2);
+        size = _gfx_pages(dev) * page;
+        offset += dev->page * page;
     }
+    if( dev->upside_down ){
+        return start + size - 1 - offset;
+    }
+    return start + offset;
 }
 
-void ra8835_text_write(const ra8835_t *dev, uint8_t value){
-    /* Write text data to LCD RAM */
-    _send(dev, RA8835_MWRITE, RA8835_CMD);
-    _send(dev, value, RA8835_DATA);
+static inline uint8_t _gfx_dir(const ra8835_t *dev){
+    return dev->upside_down ? RA8835_CSRDIR_LEFT : RA8835_CSRDIR_RIGHT;
 }
 
-void ra8835_text_print(const ra8835_t *dev, const char *data){
-    /* Write text data to LCD RAM */
-    _send(dev, RA8835_MWRITE, RA8835_CMD);
-    while(*data != 0){
-        _send(dev, *data++, RA8835_DATA);
+static inline uint8_t _gfx_byte(const ra8835_t *dev, uint8_t value){
+    return dev->upside_down ? reverse[value] : value;
+}
+
+static void _fb_mark(ra8835_fb_t *fb, unsigned y, unsigned bx){
+    if( fb->hi[y] == 0 ){
+        fb->lo[y] = bx;
+        fb->hi[y] = bx + 1;
+    } else if( bx < fb->lo[y] ){
+        fb->lo[y] = bx;
+    } else if( bx >= fb->hi[y] ){
+        fb->hi[y] = bx + 1;
     }
-    
 }
 
-void ra8835_clear(const ra8835_t *dev){
-    uint16_t addr = (dev->rows / 8) * (dev->cols / 8);
+/* Gaps this small inside a read-modify-write run are read and written
+   back unchanged instead of starting a new run. Wider ones often belong to
+   runs down a column, which do better on their own */
+#define RA8835_DL_BRIDGE               (1U)
 
-    /* Set cursor adress to upper left corner */
-    _send(dev, RA8835_CSRW, RA8835_CMD);
-    _send(dev, addr & 0xFF, RA8835_DATA);
-    _send(dev, (addr >> 8) & 0xFF, RA8835_DATA);
+static inline int _dl_noop(const ra8835_dl_op_t *op){
+    return (op->keep == 0xFF) && (op->flip == 0x00);
+}
+
+/* Pending change of the byte at addr, NULL if there is none */
+static ra8835_dl_op_t *_dl_find(ra8835_dl_op_t *ops, size_t num, uint32_t addr){
+    size_t lo = 0, hi = num;
     
-    /* Set cursor autoincrement to move it right */
-    _send(dev, RA8835_CSRDIR_RIGHT, RA8835_CMD);
+    while( lo < hi ){
+        size_t mid = (lo + hi) / 2;
+        
+        if( ops[mid].addr < addr ){
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return (lo < num && ops[lo].addr == addr && !_dl_noop(&ops[lo])) ? &ops[lo] : NULL;
+}
+
+/* Move a change into the run being built, a NULL run only counts */
+static inline void _dl_take(ra8835_dl_op_t *op, uint8_t *keep, uint8_t *flip,
+                            unsigned n, int *read){
+    *read |= (op->keep != 0);
+    if( keep ){
+        keep[n] = op->keep;
+        flip[n] = op->flip;
+        op->keep = 0xFF;
+        op->flip = 0x00;
+    }
+}
+
+/* Run of changes from ops[i] on along a display RAM row. Returns how many
+   it takes, *len is its length with the bridged gaps */
+static unsigned _dl_row(ra8835_dl_op_t *ops, size_t num, size_t i, unsigned *len,
+                        uint8_t *keep, uint8_t *flip, int *read){
+    uint16_t addr = ops[i].addr;
+    unsigned n = 0, taken = 0;
     
-    /* Write zeros to LCD RAM */
-    _send(dev, RA8835_MWRITE, RA8835_CMD);
-    for(int y = 0; y < dev->rows; y++){
-        for(int x = 0; x < dev->cols/8; x++){
-            _send(dev, 0x00, RA8835_DATA);
+    for(size_t j = i; (j < num) && (n < RA8835_RUN_MAX); j++){
+        unsigned gap = ops[j].addr - addr - n;
+        
+        if( _dl_noop(&ops[j]) ){
+            continue;
         }
+        if( gap ){
+            if( gap > RA8835_DL_BRIDGE || n + gap >= RA8835_RUN_MAX ||
+                !(*read && ops[j].keep) ){
+                break;
+            }
+            if( keep ){
+                memset(&keep[n], 0xFF, gap);
+                memset(&flip[n], 0x00, gap);
+            }
+            n += gap;
+        }
+        _dl_take(&ops[j], keep, flip, n++, read);
+        taken++;
     }
+    *len = n;
+    return taken;
 }
 
-void ra8835_write_img(const ra8835_t *dev, const char img[]){
-    uint16_t addr;
+/* Run of changes from ops[i] on down a column, ap bytes apart */
+static unsigned _dl_column(ra8835_dl_op_t *ops, size_t num, size_t i, unsigned ap,
+                           unsigned *len, uint8_t *keep, uint8_t *flip, int *read){
+    uint32_t addr = ops[i].addr;
+    ra8835_dl_op_t *op = &ops[i];
+    unsigned n = 0;
+    
+    do {
+        _dl_take(op, keep, flip, n++, read);
+    } while( (n < RA8835_RUN_MAX) && (op = _dl_find(ops, num, addr + n * ap)) );
+    *len = n;
+    return n;
+}
 
-    /* Set cursor adress to upper left corner */
-    addr = (dev->rows / 8) * (dev->cols / 8);
+/* Replay the display list, see ra8835_dl_t */
+static void _dl_replay(const ra8835_t *dev){
+    ra8835_dl_t *dl = dev->dl;
+    ra8835_dl_op_t *ops = dl->ops;
+    uint8_t keep[RA8835_RUN_MAX], flip[RA8835_RUN_MAX], buf[RA8835_RUN_MAX];
+    unsigned ap = _cpl(dev);
+    size_t num = 0;
+    
+    if( dl->num == 0 ){
+        return;
+    }
+    
+    /* Insertion sort keeps the recording order of changes to the same byte
+       and is quick on the nearly sorted lists drawing produces. Upside-down
+       panels get them in falling address order, so there they are sorted
+       that way and turned around once folded, when every address is left
+       only once */
+    for(size_t i = 1; i < dl->num; i++){
+        ra8835_dl_op_t op = ops[i];
+        size_t j = i;
+        
+        while( j && (dev->upside_down ? ops[j - 1].addr < op.addr
+                                      : ops[j - 1].addr > op.addr) ){
+            ops[j] = ops[j - 1];
+            j--;
+        }
+        ops[j] = op;
+    }
+    for(size_t i = 0; i < dl->num; i++){
+        if( num && ops[num - 1].addr == ops[i].addr ){
+            ops[num - 1].flip = (ops[num - 1].flip & ops[i].keep) ^ ops[i].flip;
+            ops[num - 1].keep &= ops[i].keep;
+        } else {
+            ops[num++] = ops[i];
+        }
+    }
+    dl->num = 0;
     if( dev->upside_down ){
-        /* Some displays are upside down, so... */
-        /* Set cursor adress to down right corner */
-        addr += dev->rows * (dev->cols / 8) - 1;
+        for(size_t i = 0; i < num / 2; i++){
+            ra8835_dl_op_t op = ops[i];
+            
+            ops[i] = ops[num - 1 - i];
+            ops[num - 1 - i] = op;
+        }
     }
-    _send(dev, RA8835_CSRW, RA8835_CMD); 
-    _send(dev, addr & 0xFF, RA8835_DATA);
-    _send(dev, (addr >> 8) & 0xFF, RA8835_DATA);
     
-    /* Set cursor autoincrement to move it properly */
-    if( !dev->upside_down ){
-        _send(dev, RA8835_CSRDIR_RIGHT, RA8835_CMD);
-    } else {
-        _send(dev, RA8835_CSRDIR_LEFT, RA8835_CMD);
+    /* Changes are turned into no-ops as they are sent. Each goes out with
+       the longer of the runs it starts, along the row or down the column */
+    for(size_t i = 0; i < num; i++){
+        uint16_t addr = ops[i].addr;
+        uint8_t step = RA8835_CSRDIR_RIGHT;
+        unsigned n;
+        int read = 0, probe = 0;
+        
+        if( _dl_noop(&ops[i]) ){
+            continue;
+        }
+        if( _dl_column(ops, num, i, ap, &n, NULL, NULL, &probe) >
+            _dl_row(ops, num, i, &n, NULL, NULL, &read) ){
+            step = RA8835_CSRDIR_DOWN;
+        }
+        read = 0;
+        if( step == RA8835_CSRDIR_DOWN ){
+            _dl_column(ops, num, i, ap, &n, keep, flip, &read);
+        } else {
+            _dl_row(ops, num, i, &n, keep, flip, &read);
+        }
+        
+        /* With a ra8835_ctl_t direction and cursor are only sent if they
+           change, a run right where the last one ended goes out as bare
+           data */
+        _cmd(dev, step);
+        if( read ){
+            int same = 1;
+            
+            _set_cursor(dev, addr);
+            _read_burst(dev, RA8835_MREAD, buf, n);
+            for(unsigned k = 0; k < n; k++){
+                uint8_t value = (buf[k] & keep[k]) ^ flip[k];
+                
+                same &= (value == buf[k]);
+                buf[k] = value;
+            }
+            if( same ){
+                continue;
+            }
+        } else {
+            for(unsigned k = 0; k < n; k++){
+                buf[k] = flip[k];
+            }
+        }
+        _set_cursor(dev, addr);
+        ra8835_write_burst(dev, RA8835_MWRITE, buf, n);
     }
+}
 
-    /* Write picture data to LCD RAM */
-    _send(dev, RA8835_MWRITE, RA8835_CMD);
-    for(int y = 0; y < dev->rows; y++){
-        for(int x = 0; x < dev->cols/8; x++){
-            char p = img[y * (dev->cols/8) + x];
-            if( dev->upside_down ){
-                /* Reverse bits */
-                p = reverse[(size_t) p];
-            }
-            _send(dev, p, RA8835_DATA);
+/* Drop recorded changes that a full write of the page makes pointless */
+static void _dl_drop(const ra8835_t *dev){
+    ra8835_dl_t *dl = dev->dl;
+    size_t len = dev->rows * _cpl(dev);
+    uint16_t lo = dev->upside_down ? _gfx_addr(dev, len - 1) : _gfx_addr(dev, 0);
+    size_t num = 0;
+    
+    if( dl == NULL ){
+        return;
+    }
+    for(size_t i = 0; i < dl->num; i++){
+        if( (dl->ops[i].addr < lo) || (dl->ops[i].addr >= lo + len) ){
+            dl->ops[num++] = dl->ops[i];
         }
     }
+    dl->num = num;
 }
 
+/* Record that the byte at offset becomes (old & keep) ^ flip */
+static void _dl_add(const ra8835_t *dev, size_t offset, uint8_t keep, uint8_t flip){
+    ra8835_dl_t *dl = dev->dl;
+    uint16_t addr = _gfx_addr(dev, offset);
+    
+    keep = _gfx_byte(dev, keep);
+    flip = _gfx_byte(dev, flip);
+    /* Lines and fills come back to the byte they just changed */
+    if( dl->num && (dl->ops[dl->num - 1].addr == addr) ){
+        ra8835_dl_op_t *last = &dl->ops[dl->num - 1];
+        
+        last->flip = (last->flip & keep) ^ flip;
+        last->keep &= keep;
+        return;
+    }
+    if( dl->num == dl->size ){
+        _dl_replay(dev);
+    }
+    dl->ops[dl->num].addr = addr;
+    dl->ops[dl->num].keep = keep;
+    dl->ops[dl->num].flip = flip;
+    dl->num++;
+}
 
-void ra8835_put_pixel(const ra8835_t *dev, int x, int y) {
+/* Drawing goes to the shadow or the display list instead of the bus */
+static inline int _deferred(const ra8835_t *dev){
+    return dev->fb || dev->dl;
+}
+
+/* Only bytes that really change end up in the dirty span */
+static void _fb_store(const ra8835_t *dev, unsigned y, unsigned bx, uint8_t value){
+    uint8_t *p;
+    
+    if( dev->fb == NULL ){
+        _dl_add(dev, y * _cpl(dev) + bx, 0x00, value);
+        return;
+    }
+    p = &dev->fb->pix[y * _cpl(dev) + bx];
+    if( *p != value ){
+        *p = value;
+        _fb_mark(dev->fb, y, bx);
+    }
+}
+
+/* Replace the bits in mask of a byte with those of value */
+static void _fb_merge(const ra8835_t *dev, unsigned y, unsigned bx, uint8_t mask,
+                      uint8_t value){
+    if( dev->fb == NULL ){
+        _dl_add(dev, y * _cpl(dev) + bx, ~mask, value & mask);
+        return;
+    }
+    _fb_store(dev, y, bx, (dev->fb->pix[y * _cpl(dev) + bx] & ~mask) | (value & mask));
+}
+
+static inline uint8_t _apply(uint8_t value, uint8_t mask, ra8835_pixel_op_t op){
+    switch( op ){
+        case RA8835_PIXEL_CLEAR:  return value & ~mask;
+        case RA8835_PIXEL_TOGGLE: return value ^ mask;
+        default:                  return value | mask;
+    }
+}
+
+/* Apply op to the pixels in mask of graphics byte bx in row y, keeping the
+   others. Goes to the shadow if there is one, else read-modify-write */
+static void _gfx_modify(const ra8835_t *dev, unsigned bx, unsigned y,
+                        uint8_t mask, ra8835_pixel_op_t op){
+    size_t offset = y * _cpl(dev) + bx;
     uint16_t addr;
+    uint8_t old, value;
+    
+    if( dev->fb ){
+        _fb_store(dev, y, bx, _apply(dev->fb->pix[offset], mask, op));
+        return;
+    }
+    if( dev->dl ){
+        _dl_add(dev, offset, (op == RA8835_PIXEL_TOGGLE) ? 0xFF : ~mask,
+                (op == RA8835_PIXEL_CLEAR) ? 0x00 : mask);
+        return;
+    }
+    
+    addr = _gfx_addr(dev, offset);
+    _set_cursor(dev, addr);
+    _read_burst(dev, RA8835_MREAD, &old, 1);
+    value = _apply(old, _gfx_byte(dev, mask), op);
+    if( value != old ){
+        /* MREAD moved the cursor on */
+        _set_cursor(dev, addr);
+        ra8835_write_burst(dev, RA8835_MWRITE, &value, 1);
+    }
+}
 
-    /* Set cursor adress to upper left corner */
-    addr = (dev->rows / 8) * (dev->cols / 8);
+/* Cursor direction that moves by (sx, sy) bytes on screen */
+static uint8_t _gfx_step_dir(const ra8835_t *dev, int sx, int sy){
+    int fwd = ((sx + sy) > 0) != (dev->upside_down != 0);
+    
+    if( sx ){
+        return fwd ? RA8835_CSRDIR_RIGHT : RA8835_CSRDIR_LEFT;
+    }
+    return fwd ? RA8835_CSRDIR_DOWN : RA8835_CSRDIR_UP;
+}
 
-    /* Set address of the point */
-    addr += y * (dev->cols/8) + (x/8);
- 
-    _send(dev, RA8835_CSRW, RA8835_CMD);
-    _send(dev, addr & 0xFF, RA8835_DATA); //младший байт
-    _send(dev, (addr >> 8) & 0xFF, RA8835_DATA); //старший байт
+/* Apply op to n graphics bytes starting at byte bx of row y, each next one
+   (sx, sy) further on, with one MREAD and one MWRITE burst for all */
+static void _gfx_run(const ra8835_t *dev, unsigned bx, unsigned y, int sx, int sy,
+                     const uint8_t *mask, unsigned n, ra8835_pixel_op_t op){
+    uint8_t buf[RA8835_RUN_MAX];
+    uint16_t addr;
+    
+    assert(n <= RA8835_RUN_MAX);
+    
+    if( _deferred(dev) || n == 1 ){
+        for(unsigned i = 0; i < n; i++){
+            _gfx_modify(dev, bx + i * sx, y + i * sy, mask[i], op);
+        }
+        return;
+    }
+    
+    addr = _gfx_addr(dev, y * _cpl(dev) + bx);
+    _cmd(dev, _gfx_step_dir(dev, sx, sy));
+    _set_cursor(dev, addr);
+    _read_burst(dev, RA8835_MREAD, buf, n);
+    for(unsigned i = 0; i < n; i++){
+        buf[i] = _apply(buf[i], _gfx_byte(dev, mask[i]), op);
+    }
+    _set_cursor(dev, addr);
+    ra8835_write_burst(dev, RA8835_MWRITE, buf, n);
+}
 
-    /* Write picture data to LCD RAM */
-    _send(dev, RA8835_MWRITE, RA8835_CMD);
-    
-    _send(dev, (0x01 << (7 - x%8)), RA8835_DATA);
-
-}
-
-void ra8835_line (const ra8835_t *dev, int x1, int y1, int x2, int y2) {
-    //Координаты точек
-
-    int dx = (x2 - x1 >= 0 ? 1 : -1);
-    int dy = (y2 - y1 >= 0 ? 1 : -1);
- 
-    int lengthX = abs(x2 - x1);
-    int lengthY = abs(y2 - y1);
- 
-    int length = (lengthX - lengthY >=0 ? lengthX : lengthY);
- 
-     if (length == 0)
-     {
-        ra8835_put_pixel(dev, x1, y1);
-        return;
-     }
- 
-     if (lengthY <= lengthX)
-     {
-            // Начальные значения
-         int x = x1;
-         int y = y1;
-         int d = -lengthX;
- 
-            // Основной цикл
-         length++;
-         while(length >0)
-            {
-                  // ra8835_put_pixel(&the_display, x1, y1);
-                uint16_t addr;
-
-                /* Set cursor adress to upper left corner */
-                addr = (dev->rows / 8) * (dev->cols / 8);
-
-                /* Set address of the point */
-                addr += y * (dev->cols/8) + (x/8);
-                //Передаём адрес
-                _send(dev, RA8835_CSRW, RA8835_CMD); 
-                _send(dev, addr & 0xFF, RA8835_DATA);
-                _send(dev, (addr >> 8) & 0xFF, RA8835_DATA);
-
-                _send(dev, RA8835_MWRITE, RA8835_CMD);
-
-
-                int numberByte = x/8; 
-                int y_old = y; //Чтобы определять, не поменялась ли строка
-                int maskInit = 0x01; //Для формирования маски
-                int mask = 0; //Формируемая маска
-
-                while (y == y_old && (length-- >0)) //пока находимся на одной и той же строке
-                {   
-                    mask = mask + (maskInit << (7 - x%8)); //Формируем маску
-
-                    x += dx;
-
-                    d += 2 * lengthY;
-                    if (d > 0) {
-                        d -= 2 * lengthX;
-                        y += dy;
-                        _send(dev, mask, RA8835_DATA);
-                        break;
-                  }
-                  if (x/8 != numberByte) { //Если начался новый байт, то передаём сформированную маску
-                    _send(dev, mask, RA8835_DATA);
-                    numberByte = x/8;
-                    mask = 0;
-                    }
-                }
+/* Replace the pixels under mask[i] of n graphics bytes from row y down by
+   bits[i], with one MREAD and one MWRITE burst for all */
+static void _gfx_merge_column(const ra8835_t *dev, unsigned bx, unsigned y,
+                              uint8_t mask, const uint8_t *bits, unsigned n){
+    uint8_t buf[RA8835_RUN_MAX];
+    uint16_t addr;
+    
+    assert(n <= RA8835_RUN_MAX);
+    
+    addr = _gfx_addr(dev, y * _cpl(dev) + bx);
+    _cmd(dev, _gfx_step_dir(dev, 0, 1));
+    _set_cursor(dev, addr);
+    _read_burst(dev, RA8835_MREAD, buf, n);
+    for(unsigned i = 0; i < n; i++){
+        buf[i] = (buf[i] & ~_gfx_byte(dev, mask)) | _gfx_byte(dev, bits[i] & mask);
+    }
+    _set_cursor(dev, addr);
+    ra8835_write_burst(dev, RA8835_MWRITE, buf, n);
+}
+
+/* Apply op with the same mask to h bytes of column bx from row y down */
+static void _gfx_column(const ra8835_t *dev, unsigned bx, unsigned y, unsigned h,
+                        uint8_t mask, ra8835_pixel_op_t op){
+    uint8_t masks[RA8835_RUN_MAX];
+    
+    memset(masks, mask, sizeof(masks));
+    while( h ){
+        unsigned n = (h < RA8835_RUN_MAX) ? h : RA8835_RUN_MAX;
+        
+        _gfx_run(dev, bx, y, 0, 1, masks, n, op);
+        y += n;
+        h -= n;
+    }
+}
 
+/* Apply op to whole bytes bx .. bx + n - 1 of rows y .. y + h - 1 */
+static void _gfx_block(const ra8835_t *dev, unsigned bx, unsigned y, unsigned n,
+                       unsigned h, ra8835_pixel_op_t op){
+    unsigned cpl = _cpl(dev);
+    uint8_t value = (op == RA8835_PIXEL_SET) ? 0xFF : 0x00;
+    
+    if( _deferred(dev) ){
+        for(unsigned r = y; r < y + h; r++){
+            for(unsigned c = bx; c < bx + n; c++){
+                _gfx_modify(dev, c, r, 0xFF, op);
+            }
+        }
+        return;
+    }
+    
+    if( op == RA8835_PIXEL_TOGGLE ){
+        uint8_t masks[RA8835_RUN_MAX];
+        
+        /* Needs the old content, go along the rows in read-modify-write runs */
+        memset(masks, 0xFF, sizeof(masks));
+        for(unsigned r = y; r < y + h; r++){
+            for(unsigned c = bx; c < bx + n; c += RA8835_RUN_MAX){
+                unsigned len = bx + n - c;
+                
+                _gfx_run(dev, c, r, 1, 0, masks,
+                         (len < RA8835_RUN_MAX) ? len : RA8835_RUN_MAX, op);
             }
-      }
-      else
-      {
-            // Начальные значения
-            int x = x1;
-            int y = y1;
-            int d = - lengthY;
- 
-            // Основной цикл
-            length++;
-            while(length-- > 0)
-            {   
-                ra8835_put_pixel(dev, x, y);
-                y += dy;
-                d += 2* lengthX;
-                if (d > 0) {
-                        d -= 2 * lengthY;
-                        x += dx;
-                  }
-
-            }
-      }
-}
\ No newline at end of file
+        }
+        return;
+    }
+    
+    /* Whole rows follow each other in display RAM, then one burst does */
+    if( n == cpl ){
+        n *= h;
+        h = 1;
+    }
+    _cmd(dev, _gfx_dir(dev));
+    for(unsigned r = y; r < y + h; r++){
+        _set_cursor(dev, _gfx_addr(dev, r * cpl + bx));
+        _begin(dev, RA8835_MWRITE);
+        _repeat(dev, value, n);
+        _end(dev);
+    }
+}
+
+/* Straight to display RAM, bypassing the shadow */
+static void _gfx_clear(const ra8835_t *dev){
+    size_t len = dev->rows * _cpl(dev);
+    
+    /* Zeros look the same either way round, start at the lowest address */
+    ra8835_fill_region(dev, dev->upside_down ? _gfx_addr(dev, len - 1) : _gfx_addr(dev, 0),
+                       len, 0x00);
+}
+
+/* Selects layered screen composition and screen text/graphics mode */
+static void _ovlay_setup(const ra8835_t *dev){
+    /* MX[1:0] from dev->mix */
+    /* DM[1:2] = 00, text mode, OV = 0, two-layer mixed text and graphics */
+    /* or DM[1:2] = 11, graphics mode, OV = 1, three-layer graphics */
+    const uint8_t ovlay = (dev->mix & 0x03) | (_three(dev) ? 0x1C : 0x00);
+    ra8835_write_burst(dev, RA8835_OVLAY, &ovlay, 1);
+}
+
+/* Leftmost pixel of display RAM shown, the panel's point of view */
+static inline unsigned _hscroll(const ra8835_t *dev){
+    if( dev->upside_down ){
+        return _cols(dev) - dev->cols - dev->hscroll;
+    }
+    return dev->hscroll;
+}
+
+/* Point the layers at their display RAM, SAD2 follows the graphics scroll,
+   both follow the byte part of the horizontal scroll */
+static void _scroll_setup(const ra8835_t *dev){
+    unsigned line = dev->scroll;
+    uint16_t text = _map(dev, RA8835_MAP_LAYER1) + _hscroll(dev) / 8;
+    uint16_t over = 0;
+    uint16_t addr, tail = 0;
+    uint8_t lines = dev->rows;
+    
+    if( dev->upside_down ){
+        line = (_gfx_pages(dev) - 1) * dev->rows - line;
+    }
+    addr = _map(dev, RA8835_MAP_LAYER2) + line * _cpl(dev) + _hscroll(dev) / 8;
+    if( _three(dev) ){
+        over = _map(dev, RA8835_MAP_LAYER3) + _hscroll(dev) / 8;
+    }
+    
+    /* A strip takes the bottom lines of the second layer, block 2 ends
+       early and block 4 shows the strip. Upside-down the bottom is the
+       top for the controller, there the strip goes first. */
+    if( dev->strip_lines ){
+        tail = dev->strip + _hscroll(dev) / 8;
+        lines = dev->rows - dev->strip_lines - 1;
+        if( dev->upside_down ){
+            uint16_t head = tail;
+            
+            tail = addr + dev->strip_lines * _cpl(dev);
+            addr = head;
+            lines = dev->strip_lines - 1;
+        }
+    }
+    
+    /* First layer (text), 8*8 characters, no scroll */
+    /* Second layer (graphics) */
+    /* Third layer (graphics) only in three-layer mode */
+    /* Placed as dev->map says */
+    const uint8_t scroll[] = {
+        text & 0xFF,        //P1: SAD 1L
+        (text >> 8) & 0xFF, //P2: SAD 1H
+        dev->rows,          //P3: SL1
+        addr & 0xFF,        //P4: SAD 2L
+        (addr >> 8) & 0xFF, //P5: SAD 2H
+        lines,              //P6: SL2
+        over & 0xFF,        //P7: SAD 3L
+        (over >> 8) & 0xFF, //P8: SAD 3H
+        tail & 0xFF,        //P9: SAD 4L
+        (tail >> 8) & 0xFF, //P10: SAD 4H
+    };
+    ra8835_write_burst(dev, RA8835_SCROLL, scroll, sizeof(scroll));
+}
+
+/* Signature header of the font as this build uploads it */
+static void _font_sig(const ra8835_t *dev, uint8_t *sig){
+    uint16_t a = 0, b = 0;
+    
+    /* Fletcher-16 over the glyphs */
+    for(unsigned i = 0; i < 256 * 8; i++){
+        a = (a + ra8835_font[i]) % 255;
+        b = (b + a) % 255;
+    }
+    sig[0] = 'R';
+    sig[1] = 'A';
+    sig[2] = 0x88;
+    sig[3] = 0x35;
+    sig[4] = a;
+    sig[5] = b;
+    sig[6] = dev->upside_down ? 1 : 0;
+    sig[7] = 0;
+}
+
+/* Upload glyphs first..last to the character generator */
+static void _font_load(const ra8835_t *dev, unsigned first, unsigned last){
+    _set_cursor(dev, _map(dev, RA8835_MAP_CGRAM) + first * 8);
+    /* Set cursor autoincrement to move it properly */
+    _cmd(dev, RA8835_CSRDIR_RIGHT);
+    /* Write character glyphs to LCD RAM */
+    if( !dev->upside_down ){
+        ra8835_write_burst(dev, RA8835_MWRITE, &ra8835_font[first * 8],
+                           (last - first + 1) * 8);
+    } else {
+#if CONFIG_RA8835_FLIPPED_FONT
+        ra8835_write_burst(dev, RA8835_MWRITE, &ra8835_font_flipped[first * 8],
+                           (last - first + 1) * 8);
+#else
+        _begin(dev, RA8835_MWRITE);
+        for(unsigned c = first; c <= last; c++){
+            for(unsigned l = 0; l < 8; l++){
+                _cycle(dev, reverse[ra8835_font[c*8 + 7 - l]]);
+            }
+        }
+        _end(dev);
+#endif
+    }
+}
+
+/* Upload those of glyphs first..last that are missing, in runs, and note
+   them in the signature. The bitmap goes last, so a reset half way through
+   never claims a glyph that is not there. */
+static void _font_want(const ra8835_t *dev, uint8_t *loaded, unsigned first,
+                       unsigned last){
+    uint16_t sig = _map(dev, RA8835_MAP_CGRAM) + 256 * 8 + 8;
+    unsigned lo = 256, hi = 0;
+    
+    for(unsigned c = first; c <= last; c++){
+        unsigned run = c;
+        
+        if( loaded[c / 8] & (1 << (c % 8)) ){
+            continue;
+        }
+        while( c < last && !(loaded[(c + 1) / 8] & (1 << ((c + 1) % 8))) ){
+            c++;
+        }
+        _font_load(dev, run, c);
+        for(unsigned k = run; k <= c; k++){
+            loaded[k / 8] |= 1 << (k % 8);
+        }
+        lo = (run < lo) ? run : lo;
+        hi = c;
+    }
+    if( lo <= hi ){
+        _set_cursor(dev, sig + lo / 8);
+        ra8835_write_burst(dev, RA8835_MWRITE, &loaded[lo / 8], hi / 8 - lo / 8 + 1);
+    }
+}
+
+/* Load a custom font with Cyrillic characters */
+/* Also suitable for upside-down displays */
+/* See comments about A15 line in MELT displays, also tested with Winstar */
+static void _font_setup(const ra8835_t *dev){
+    uint8_t sig[RA8835_FONT_SIG_SIZE];
+    uint8_t want[8];
+    uint8_t all[256 / 8];
+    uint8_t *loaded = dev->font ? dev->font->loaded : all;
+    
+    /* After a warm reset the glyphs may still be there */
+    _set_cursor(dev, _map(dev, RA8835_MAP_CGRAM) + 256 * 8);
+    _cmd(dev, RA8835_CSRDIR_RIGHT);
+    _read_burst(dev, RA8835_MREAD, sig, sizeof(sig));
+    _font_sig(dev, want);
+    if( memcmp(sig, want, sizeof(want)) == 0 ){
+        memcpy(loaded, &sig[8], 256 / 8);
+    } else {
+        memset(loaded, 0, 256 / 8);
+        _set_cursor(dev, _map(dev, RA8835_MAP_CGRAM) + 256 * 8);
+        memcpy(sig, want, sizeof(want));
+        memset(&sig[8], 0, 256 / 8);
+        ra8835_write_burst(dev, RA8835_MWRITE, sig, sizeof(sig));
+    }
+    
+    if( dev->font == NULL ){
+        _font_want(dev, loaded, 0, 255);
+    } else {
+        for(unsigned i = 0; i < dev->font->num; i++){
+            _font_want(dev, loaded, dev->font->ranges[i].first,
+                       dev->font->ranges[i].last);
+        }
+    }
+    
+    /* Also need to set CG RAM? */
+    const uint8_t cgram[] = {
+        _map(dev, RA8835_MAP_CGRAM) & 0xFF,
+        _map(dev, RA8835_MAP_CGRAM) >> 8,
+    };
+    ra8835_write_burst(dev, RA8835_CGRAM_ADR, cgram, sizeof(cgram));
+}
+
+/* Make sure the glyphs of a text are in the character generator, without
+   moving the text cursor */
+static void _font_need(const ra8835_t *dev, const uint8_t *text, size_t len){
+    uint16_t addr;
+    size_t i;
+    
+    if( dev->font == NULL || !dev->font->lazy ){
+        return;
+    }
+    for(i = 0; i < len; i++){
+        if( !(dev->font->loaded[text[i] / 8] & (1 << (text[i] % 8))) ){
+            break;
+        }
+    }
+    if( i == len ){
+        return;
+    }
+    
+    addr = _get_cursor(dev);
+    for(; i < len; i++){
+        _font_want(dev, dev->font->loaded, text[i], text[i]);
+    }
+    _set_cursor(dev, addr);
+    _cmd(dev, dev->upside_down ? RA8835_CSRDIR_LEFT : RA8835_CSRDIR_RIGHT);
+}
+
+/* Display RAM each region needs for the descriptor */
+static size_t _map_need(const ra8835_t *dev, ra8835_map_id_t id){
+    size_t page = dev->rows * (size_t)_cpl(dev);
+    
+    switch( id ){
+        case RA8835_MAP_LAYER1:
+            return _three(dev) ? page : (dev->rows / 8) * (size_t)_cpl(dev);
+        case RA8835_MAP_LAYER2:
+            return _gfx_pages(dev) * page;
+        case RA8835_MAP_LAYER3:
+            return _three(dev) ? page : 0;
+        case RA8835_MAP_CGRAM:
+            return _three(dev) ? 0 : 256 * 8 + RA8835_FONT_SIG_SIZE;
+        default:
+            return 0;
+    }
+}
+
+int ra8835_map_plan(const ra8835_t *dev, ra8835_map_t *map){
+    size_t addr = 0, addr2;
+    
+    memset(map, 0, sizeof(*map));
+    for(unsigned id = RA8835_MAP_LAYER1; id <= RA8835_MAP_LAYER3; id++){
+        map->region[id].addr = addr;
+        map->region[id].size = _map_need(dev, id);
+        addr += _map_need(dev, id);
+    }
+    if( addr > RA8835_VRAM_SIZE ){
+        return -ENOMEM;
+    }
+    
+    /* Without text the character generator is not needed, layer 3 may use its space */
+    if( _three(dev) ){
+        map->region[RA8835_MAP_FREE].addr = addr;
+        map->region[RA8835_MAP_FREE].size = RA8835_VRAM_SIZE - addr;
+        return 0;
+    }
+    if( addr > RA8835_CGRAM_ADDR ){
+        return -ENOMEM;
+    }
+    map->region[RA8835_MAP_CGRAM].addr = RA8835_CGRAM_ADDR;
+    map->region[RA8835_MAP_CGRAM].size = _map_need(dev, RA8835_MAP_CGRAM);
+    addr2 = RA8835_CGRAM_ADDR + _map_need(dev, RA8835_MAP_CGRAM);
+    
+    /* Free is the larger of the gaps below and above the character generator */
+    if( RA8835_CGRAM_ADDR - addr >= RA8835_VRAM_SIZE - addr2 ){
+        map->region[RA8835_MAP_FREE].addr = addr;
+        map->region[RA8835_MAP_FREE].size = RA8835_CGRAM_ADDR - addr;
+    } else {
+        map->region[RA8835_MAP_FREE].addr = addr2;
+        map->region[RA8835_MAP_FREE].size = RA8835_VRAM_SIZE - addr2;
+    }
+    return 0;
+}
+
+int ra8835_map_check(const ra8835_t *dev, const ra8835_map_t *map){
+    const ra8835_region_t *r = map->region;
+    
+    for(unsigned i = 0; i < RA8835_MAP_NUMOF; i++){
+        if( r[i].size < _map_need(dev, i) ){
+            return -EINVAL;
+        }
+        if( (size_t)r[i].addr + r[i].size > RA8835_VRAM_SIZE ){
+            return -ENOMEM;
+        }
+        for(unsigned j = 0; j < i; j++){
+            if( r[i].size && r[j].size &&
+                r[i].addr < r[j].addr + r[j].size && r[j].addr < r[i].addr + r[i].size ){
+                return -EINVAL;
+            }
+        }
+    }
+    return 0;
+}
+
+int ra8835_init(ra8835_t *dev){
+    int res;
+    
+    assert(_cols(dev) >= dev->cols && _cols(dev) % 8 == 0);
+    if( dev->map.region[RA8835_MAP_LAYER2].size == 0 ){
+        res = ra8835_map_plan(dev, &dev->map);
+    } else {
+        res = ra8835_map_check(dev, &dev->map);
+    }
+    if( res < 0 ){
+        return res;
+    }
+    
+#if CONFIG_RA8835_SIM
+    ra8835_sim_attach(dev);
+#endif
+    
+    _pin_init(dev->wr, GPIO_OUT); // ~WR
+    _pin_init(dev->rd, GPIO_OUT); // ~RD
+    _pin_init(dev->cs, GPIO_OUT); // ~CS
+    _pin_init(dev->a0, GPIO_OUT); // A0
+    _pin_init(dev->rst, GPIO_OUT);// ~RST
+    
+    for( int i = 0; i < 8; i++){
+        _pin_init(dev->data[i], GPIO_OUT); // D[i]
+    }
+    _bus_setup(dev);
+    
+    /* These lines are default high, ~RD is never touched again */
+    _pin_set(dev->wr);
+    _pin_set(dev->rd);
+    _pin_set(dev->cs);
+    _pin_set(dev->rst);
+    
+    /* Reset pulse */
+    _sleep_us(RA8835_RESET_PULSE);
+    _pin_clear(dev->rst);
+    _sleep_us(RA8835_RESET_PULSE);
+    _pin_set(dev->rst);
+    
+    /* Nothing is known about the controller after a reset */
+    if( dev->ctl ){
+        memset(dev->ctl, 0, sizeof(*dev->ctl));
+        dev->ctl->ap = _cpl(dev);
+    }
+    
+    const uint8_t sysset[] = {
+        0x31,               //P1: IV =1;M0=1, "External" CGRAM (or last ROM pages);M1=0,No D6 correction; W/S=0,Single-Panel; M2=0,8-Pixel character
+        0x87,               //P2: WF=1,two-frame AC Driver;FX=8,Set Horizontal Character Size 8
+        8-1,                //P3: Set Vertical Character Size
+        dev->cols/8 - 1,    //P4: CR,Bytes per display line
+        0x2F,               //P5: T/CR,Line Length
+        dev->rows - 1,      //P6: L/F,Lines per frame
+        _cpl(dev) & 0xFF,   //P7: APL
+        _cpl(dev) >> 8,     //P8: APH,define the horizontal address range of the virtual address
+    };
+    ra8835_write_burst(dev, RA8835_SYSTEM_SET, sysset, sizeof(sysset));
+    
+    /* Memory allocation setup */
+    dev->strip_lines = 0;
+    dev->layer = 2;
+    dev->page = 0;
+    dev->scroll = 0;
+    dev->hscroll = 0;
+    _scroll_setup(dev);
+    
+    /* Set Cursor Size and Shape */
+    const uint8_t csrform[] = {
+        0x04,               //P1: Set Horizontal Size
+        0x86,               //p2: Set Vertical Size; CM = 1 for gfx mode
+    };
+    ra8835_write_burst(dev, RA8835_CSRFORM, csrform, sizeof(csrform));
+    
+    const uint8_t hdot = _hscroll(dev) % 8;
+    ra8835_write_burst(dev, RA8835_HDOT_SCR, &hdot, 1);
+    
+    _ovlay_setup(dev);
+    
+    if( !_three(dev) ){
+        _font_setup(dev);
+    }
+    
+    if( dev->fb ){
+        assert((unsigned)_cols(dev) <= CONFIG_RA8835_FB_COLS);
+        assert(dev->rows <= CONFIG_RA8835_FB_ROWS);
+        /* Display RAM is cleared right below, so is the shadow */
+        memset(dev->fb, 0, sizeof(*dev->fb));
+    }
+    if( dev->dl ){
+        dev->dl->num = 0;
+    }
+    /* Filled with blanks by ra8835_text_clear() below */
+    assert(!dev->text || (unsigned)(dev->rows / 8 * _cpl(dev)) <= CONFIG_RA8835_TEXT_SIZE);
+    for(unsigned p = _gfx_pages(dev); p-- > 0;){
+        dev->page = p;
+        _gfx_clear(dev);
+    }
+    if( _three(dev) ){
+        dev->layer = 3;
+        _gfx_clear(dev);
+        dev->layer = 1;
+        _gfx_clear(dev);
+        dev->layer = 2;
+    } else {
+        ra8835_text_clear(dev);
+    }
+    
+    /* Display on */
+    /* SAD3 blank, SAD2+SAD4 no flashing, SAD1 no flashing, cursor blank */
+    /* SAD3 no flashing in three-layer mode */
+    const uint8_t attr = _three(dev) ? 0x54 : 0x14;
+    ra8835_write_burst(dev, RA8835_DISPLAY_ON, &attr, 1);
+    
+    return 0;
+}
+
+/* Unchanged characters between two changed runs that are rewritten rather
+   than paid for with a CSRW and an MWRITE */
+#define RA8835_TEXT_BRIDGE             (3U)
+
+/* Characters ra8835_text_printf() formats before sending them */
+#define RA8835_PRINTF_CHUNK            (16U)
+
+/* Characters on the text layer */
+static inline size_t _text_size(const ra8835_t *dev){
+    return dev->rows / 8 * _cpl(dev);
+}
+
+/* The text shadow, if there is a text layer to shadow */
+static inline ra8835_text_t *_text(const ra8835_t *dev){
+    return _three(dev) ? NULL : dev->text;
+}
+
+/* Display RAM address of character i of the text layer, counted the way
+   the application sees it */
+static uint16_t _text_addr(const ra8835_t *dev, size_t i){
+    if( dev->upside_down ){
+        i = _text_size(dev) - i - 1;
+    }
+    return _map(dev, RA8835_MAP_LAYER1) + i;
+}
+
+/* Note text written at the text cursor in the shadow */
+static void _text_note(const ra8835_t *dev, const uint8_t *data, size_t len){
+    ra8835_text_t *text = _text(dev);
+    size_t i;
+    
+    if( text == NULL ){
+        return;
+    }
+    i = (uint16_t)(_get_cursor(dev) - _map(dev, RA8835_MAP_LAYER1));
+    if( i >= _text_size(dev) ){
+        return;
+    }
+    if( dev->upside_down ){
+        i = _text_size(dev) - i - 1;
+    }
+    if( len > _text_size(dev) - i ){
+        len = _text_size(dev) - i;
+    }
+    memcpy(&text->chr[i], data, len);
+}
+
+void ra8835_text_clear(const ra8835_t *dev){
+    _font_need(dev, (const uint8_t *)" ", 1);
+    
+    /* Write blanks to LCD RAM */
+    ra8835_fill_region(dev, _map(dev, RA8835_MAP_LAYER1), _text_size(dev), ' ');
+    if( _text(dev) ){
+        memset(_text(dev)->chr, ' ', _text_size(dev));
+    }
+    ra8835_text_home(dev);
+}
+
+void ra8835_text_home(const ra8835_t *dev){
+    ra8835_text_set_cursor(dev, 0, 0);
+}
+
+void ra8835_text_set_cursor(const ra8835_t *dev, uint8_t col, uint8_t row){
+    /* Set cursor adress to upper left corner */
+    _set_cursor(dev, _text_addr(dev, row * _cpl(dev) + col));
+    
+    /* Set cursor autoincrement to move it properly */
+    if( !dev->upside_down ){
+        _cmd(dev, RA8835_CSRDIR_RIGHT);
+    } else {
+        _cmd(dev, RA8835_CSRDIR_LEFT);
+    }
+}
+
+void ra8835_text_write(const ra8835_t *dev, uint8_t value){
+    _font_need(dev, &value, 1);
+    _text_note(dev, &value, 1);
+    /* Write text data to LCD RAM */
+    ra8835_write_burst(dev, RA8835_MWRITE, &value, 1);
+}
+
+void ra8835_text_print(const ra8835_t *dev, const char *data){
+    uint32_t t0 = _stats_start(dev);
+    size_t len = strlen(data);
+    
+    _font_need(dev, (const uint8_t *)data, len);
+    _text_note(dev, (const uint8_t *)data, len);
+    /* Write text data to LCD RAM */
+    ra8835_write_burst(dev, RA8835_MWRITE, (const uint8_t *)data, len);
+    _stats_stop(dev, RA8835_STATS_TEXT_PRINT, t0);
+}
+
+/* Write n characters at character i of the text layer */
+static void _text_put(const ra8835_t *dev, size_t i, const uint8_t *s, size_t n){
+    _font_need(dev, s, n);
+    _set_cursor(dev, _text_addr(dev, i));
+    _cmd(dev, dev->upside_down ? RA8835_CSRDIR_LEFT : RA8835_CSRDIR_RIGHT);
+    ra8835_write_burst(dev, RA8835_MWRITE, s, n);
+    if( _text(dev) ){
+        memcpy(&_text(dev)->chr[i], s, n);
+    }
+}
+
+/* Put len characters at character at of the text layer, cut off at its
+   end. With a shadow only the runs that differ are sent. */
+static void _text_diff(const ra8835_t *dev, size_t at, const uint8_t *s, size_t len){
+    ra8835_text_t *text = _text(dev);
+    size_t i = 0;
+    
+    if( at >= _text_size(dev) ){
+        return;
+    }
+    if( len > _text_size(dev) - at ){
+        len = _text_size(dev) - at;
+    }
+    if( text == NULL ){
+        _text_put(dev, at, s, len);
+        return;
+    }
+    
+    while( i < len ){
+        size_t n, gap;
+        
+        if( text->chr[at + i] == s[i] ){
+            i++;
+            continue;
+        }
+        /* A run of changes, taking in short stretches of unchanged ones */
+        for(n = 1, gap = 0; i + n + gap < len; ){
+            if( text->chr[at + i + n + gap] != s[i + n + gap] ){
+                n += gap + 1;
+                gap = 0;
+            } else if( ++gap > RA8835_TEXT_BRIDGE ){
+                break;
+            }
+        }
+        _text_put(dev, at + i, &s[i], n);
+        i += n;
+    }
+}
+
+void ra8835_text_update(const ra8835_t *dev, uint8_t col, uint8_t row,
+                        const char *data){
+    _text_diff(dev, row * _cpl(dev) + col, (const uint8_t *)data, strlen(data));
+}
+
+/* Formatted text on its way to the text layer, sent in chunks */
+typedef struct {
+    const ra8835_t *dev;
+    size_t at;                  /* where buf goes on the text layer */
+    size_t num;                 /* characters formatted so far */
+    uint8_t len;                /* characters in buf */
+    uint8_t buf[RA8835_PRINTF_CHUNK];
+} _printf_t;
+
+static void _printf_flush(_printf_t *out){
+    if( out->len ){
+        _text_diff(out->dev, out->at, out->buf, out->len);
+        out->at += out->len;
+        out->len = 0;
+    }
+}
+
+static void _printf_putc(_printf_t *out, char c){
+    out->buf[out->len++] = c;
+    out->num++;
+    if( out->len == sizeof(out->buf) ){
+        _printf_flush(out);
+    }
+}
+
+/* A field of n characters from s, padded to width */
+static void _printf_field(_printf_t *out, const char *s, size_t n, size_t width,
+                          int left, char pad){
+    size_t fill = (width > n) ? width - n : 0;
+    
+    /* Zero padding goes after the sign */
+    if( pad == '0' && n && *s == '-' ){
+        _printf_putc(out, *s++);
+        n--;
+    }
+    while( !left && fill ){
+        _printf_putc(out, pad);
+        fill--;
+    }
+    while( n-- ){
+        _printf_putc(out, *s++);
+    }
+    while( fill-- ){
+        _printf_putc(out, ' ');
+    }
+}
+
+int ra8835_text_printf(const ra8835_t *dev, uint8_t col, uint8_t row,
+                       const char *fmt, ...){
+    static const char digits[] = "0123456789abcdef0123456789ABCDEF";
+    _printf_t out = { .dev = dev, .at = row * _cpl(dev) + col };
+    va_list ap;
+    
+    va_start(ap, fmt);
+    for(; *fmt; fmt++){
+        char num[3 * sizeof(unsigned long) + 1];
+        char *p = &num[sizeof(num)];
+        const char *s;
+        size_t width = 0, prec = SIZE_MAX;
+        int left = 0, lng = 0;
+        char pad = ' ';
+        unsigned long v;
+        unsigned base = 10;
+        
+        if( *fmt != '%' ){
+            _printf_putc(&out, *fmt);
+            continue;
+        }
+        for(fmt++; *fmt == '-' || *fmt == '0'; fmt++){
+            if( *fmt == '-' ){
+                left = 1;
+            } else {
+                pad = '0';
+            }
+        }
+        if( *fmt == '*' ){
+            int w = va_arg(ap, int);
+            left |= (w < 0);
+            width = (w < 0) ? -(unsigned)w : (unsigned)w;
+            fmt++;
+        }
+        for(; *fmt >= '0' && *fmt <= '9'; fmt++){
+            width = width * 10 + (*fmt - '0');
+        }
+        if( *fmt == '.' ){
+            for(prec = 0, fmt++; *fmt >= '0' && *fmt <= '9'; fmt++){
+                prec = prec * 10 + (*fmt - '0');
+            }
+        }
+        if( *fmt == 'l' ){
+            lng = 1;
+            fmt++;
+        }
+        pad = left ? ' ' : pad;
+        
+        switch( *fmt ){
+            case 'c':
+                num[0] = va_arg(ap, int);
+                _printf_field(&out, num, 1, width, left, ' ');
+                break;
+            case 's':
+                s = va_arg(ap, const char *);
+                s = s ? s : "(null)";
+                _printf_field(&out, s, strnlen(s, prec), width, left, ' ');
+                break;
+            case 'd':
+            case 'i':
+            case 'u':
+            case 'x':
+            case 'X': {
+                int neg = 0;
+                
+                if( *fmt == 'd' || *fmt == 'i' ){
+                    long n = lng ? va_arg(ap, long) : va_arg(ap, int);
+                    
+                    neg = (n < 0);
+                    v = neg ? -(unsigned long)n : (unsigned long)n;
+                } else {
+                    v = lng ? va_arg(ap, unsigned long) : va_arg(ap, unsigned);
+                    base = (*fmt == 'u') ? 10 : 16;
+                }
+                do {
+                    *--p = digits[(v % base) + ((*fmt == 'X') ? 16 : 0)];
+                    v /= base;
+                } while( v );
+                if( neg ){
+                    *--p = '-';
+                }
+                _printf_field(&out, p, &num[sizeof(num)] - p, width, left, pad);
+                break;
+            }
+            case '\0':
+                fmt--;
+                break;
+            default:
+                /* %% and anything not understood go out as they are */
+                _printf_putc(&out, *fmt);
+                break;
+        }
+    }
+    va_end(ap);
+    _printf_flush(&out);
+    
+    return out.num;
+}
+
+void ra8835_clear(const ra8835_t *dev){
+    uint32_t t0 = _stats_start(dev);
+    
+    if( dev->fb ){
+        for(unsigned y = 0; y < dev->rows; y++){
+            for(int x = 0; x < _cpl(dev); x++){
+                _fb_store(dev, y, x, 0x00);
+            }
+        }
+    } else {
+        _dl_drop(dev);
+        _gfx_clear(dev);
+    }
+    _stats_stop(dev, RA8835_STATS_CLEAR, t0);
+}
+
+static void _write_img(const ra8835_t *dev, const char img[]){
+    size_t len = dev->rows * _cpl(dev);
+
+    if( dev->fb ){
+        for(unsigned y = 0; y < dev->rows; y++){
+            for(int x = 0; x < _cpl(dev); x++){
+                _fb_store(dev, y, x, img[y * _cpl(dev) + x]);
+            }
+        }
+        return;
+    }
+    _dl_drop(dev);
+
+    /* Set cursor adress to upper left corner */
+    /* Some displays are upside down, there it is the down right corner */
+    _set_cursor(dev, _gfx_addr(dev, 0));
+    
+    /* Set cursor autoincrement to move it properly */
+    _cmd(dev, _gfx_dir(dev));
+
+    /* Write picture data to LCD RAM */
+    if( !dev->upside_down ){
+        ra8835_write_burst(dev, RA8835_MWRITE, (const uint8_t *)img, len);
+        return;
+    }
+    _begin(dev, RA8835_MWRITE);
+    for(size_t i = 0; i < len; i++){
+        /* Reverse bits */
+        _cycle(dev, reverse[(uint8_t)img[i]]);
+    }
+    _end(dev);
+}
+
+
+/* Store byte @p i of a picture in panel order to the shadow */
+static void _fb_store_native(const ra8835_t *dev, size_t len, size_t i, uint8_t value){
+    if( dev->upside_down ){
+        i = len - 1 - i;
+    }
+    _fb_store(dev, i / _cpl(dev), i % _cpl(dev), _gfx_byte(dev, value));
+}
+
+/* Pictures in panel order are laid out like display RAM, so they go from
+   the lowest address of the page upwards */
+static inline uint16_t _native_addr(const ra8835_t *dev, size_t len){
+    return dev->upside_down ? _gfx_addr(dev, len - 1) : _gfx_addr(dev, 0);
+}
+
+static void _native_setup(const ra8835_t *dev, size_t len){
+    _set_cursor(dev, _native_addr(dev, len));
+    _cmd(dev, RA8835_CSRDIR_RIGHT);
+}
+
+void ra8835_write_img(const ra8835_t *dev, const char img[]){
+    uint32_t t0 = _stats_start(dev);
+    
+    _write_img(dev, img);
+    _stats_stop(dev, RA8835_STATS_WRITE_IMG, t0);
+}
+
+void ra8835_write_img_native(const ra8835_t *dev, const uint8_t img[]){
+    uint32_t t0 = _stats_start(dev);
+    size_t len = dev->rows * _cpl(dev);
+    
+    if( dev->fb ){
+        for(size_t i = 0; i < len; i++){
+            _fb_store_native(dev, len, i, img[i]);
+        }
+    } else {
+        _dl_drop(dev);
+        _native_setup(dev, len);
+        ra8835_write_burst(dev, RA8835_MWRITE, img, len);
+    }
+    _stats_stop(dev, RA8835_STATS_WRITE_IMG, t0);
+}
+
+/* Length of the run started by control byte @p c */
+static inline size_t _rle_run(uint8_t c){
+    return (c & RA8835_RLE_REPEAT) ? (c & 0x7F) + 2U : c + 1U;
+}
+
+static int _write_img_rle(const ra8835_t *dev, const uint8_t *rle, size_t size){
+    size_t len = dev->rows * _cpl(dev);
+    size_t out = 0;
+    size_t pos;
+    
+    /* Check the whole stream first, a broken one must not end up half
+       written */
+    for(pos = 0; pos < size; ){
+        uint8_t c = rle[pos++];
+        
+        pos += (c & RA8835_RLE_REPEAT) ? 1 : _rle_run(c);
+        out += _rle_run(c);
+    }
+    if( (pos != size) || (out != len) ){
+        return -EINVAL;
+    }
+    
+    if( dev->fb ){
+        out = 0;
+        for(pos = 0; pos < size; ){
+            uint8_t c = rle[pos++];
+            
+            for(size_t n = _rle_run(c); n; n--){
+                _fb_store_native(dev, len, out++, rle[pos]);
+                if( !(c & RA8835_RLE_REPEAT) ){
+                    pos++;
+                }
+            }
+            if( c & RA8835_RLE_REPEAT ){
+                pos++;
+            }
+        }
+        return 0;
+    }
+    
+    _dl_drop(dev);
+    _native_setup(dev, len);
+    _begin(dev, RA8835_MWRITE);
+    for(pos = 0; pos < size; ){
+        uint8_t c = rle[pos++];
+        
+        if( c & RA8835_RLE_REPEAT ){
+            _repeat(dev, rle[pos++], _rle_run(c));
+            continue;
+        }
+        for(size_t n = _rle_run(c); n; n--){
+            _cycle(dev, rle[pos++]);
+        }
+    }
+    _end(dev);
+    return 0;
+}
+
+int ra8835_write_img_rle(const ra8835_t *dev, const uint8_t *rle, size_t size){
+    uint32_t t0 = _stats_start(dev);
+    int res = _write_img_rle(dev, rle, size);
+    
+    _stats_stop(dev, RA8835_STATS_WRITE_IMG, t0);
+    return res;
+}
+
+void ra8835_put_pixel(const ra8835_t *dev, int x, int y) {
+    ra8835_pixel(dev, x, y, RA8835_PIXEL_SET);
+}
+
+void ra8835_pixel(const ra8835_t *dev, int x, int y, ra8835_pixel_op_t op){
+    if( (unsigned)x >= (unsigned)_cols(dev) || (unsigned)y >= dev->rows ){
+        return;
+    }
+    _gfx_modify(dev, x / 8, y, 0x80 >> (x % 8), op);
+}
+
+void ra8835_hline(const ra8835_t *dev, int x, int y, int w, ra8835_pixel_op_t op){
+    ra8835_fill_rect(dev, x, y, w, 1, op);
+}
+
+void ra8835_vline(const ra8835_t *dev, int x, int y, int h, ra8835_pixel_op_t op){
+    ra8835_fill_rect(dev, x, y, 1, h, op);
+}
+
+void ra8835_fill_rect(const ra8835_t *dev, int x, int y, int w, int h,
+                      ra8835_pixel_op_t op){
+    int x0 = (x < 0) ? 0 : x;
+    int y0 = (y < 0) ? 0 : y;
+    int x1 = (x + w > _cols(dev)) ? _cols(dev) : x + w;   /* exclusive */
+    int y1 = (y + h > dev->rows) ? dev->rows : y + h;
+    unsigned bl, br;            /* first and last byte column */
+    uint8_t ml, mr;             /* pixels of those bytes inside the rectangle */
+    
+    if( w <= 0 || h <= 0 || x0 >= x1 || y0 >= y1 ){
+        return;
+    }
+    h = y1 - y0;
+    bl = x0 / 8;
+    br = (x1 - 1) / 8;
+    ml = 0xFF >> (x0 % 8);
+    mr = 0xFF << (7 - (x1 - 1) % 8);
+    
+    if( bl == br ){
+        _gfx_column(dev, bl, y0, h, ml & mr, op);
+        return;
+    }
+    /* Edge bytes that are only partly covered need read-modify-write */
+    if( ml != 0xFF ){
+        _gfx_column(dev, bl++, y0, h, ml, op);
+    }
+    if( mr != 0xFF ){
+        _gfx_column(dev, br--, y0, h, mr, op);
+    }
+    if( bl <= br ){
+        _gfx_block(dev, bl, y0, br - bl + 1, h, op);
+    }
+}
+
+void ra8835_rect(const ra8835_t *dev, int x, int y, int w, int h,
+                 ra8835_pixel_op_t op){
+    if( w <= 0 || h <= 0 ){
+        return;
+    }
+    ra8835_hline(dev, x, y, w, op);
+    if( h > 1 ){
+        ra8835_hline(dev, x, y + h - 1, w, op);
+    }
+    if( h > 2 ){
+        ra8835_vline(dev, x, y + 1, h - 2, op);
+        if( w > 1 ){
+            ra8835_vline(dev, x + w - 1, y + 1, h - 2, op);
+        }
+    }
+}
+
+/* 8 source pixels from column p on, p may be up to 7 left of the row,
+   pixels outside the n bytes of the row read as 0 */
+static inline uint8_t _src_bits(const uint8_t *row, size_t n, int p){
+    int i = (p + 8) / 8 - 1;
+    unsigned sh = p - i * 8;
+    unsigned w = 0;
+    
+    if( i >= 0 && (size_t)i < n ){
+        w = row[i] << 8;
+    }
+    if( i + 1 >= 0 && (size_t)(i + 1) < n ){
+        w |= row[i + 1];
+    }
+    return (w << sh) >> 8;
+}
+
+/* Merge the source pixels under mask into byte column bx, rows y0 .. y1 - 1,
+   in column runs; the source has its upper left corner at (x, y) */
+static void _blit_column(const ra8835_t *dev, unsigned bx, uint8_t mask,
+                         int y0, int y1, const uint8_t *src, int x, int y,
+                         size_t n, size_t stride){
+    uint8_t bits[RA8835_RUN_MAX];
+    
+    while( y0 < y1 ){
+        unsigned k = y1 - y0;
+        
+        if( k > RA8835_RUN_MAX ){
+            k = RA8835_RUN_MAX;
+        }
+        for(unsigned i = 0; i < k; i++){
+            bits[i] = _src_bits(src + (y0 + i - y) * stride, n, bx * 8 - x);
+        }
+        _gfx_merge_column(dev, bx, y0, mask, bits, k);
+        y0 += k;
+    }
+}
+
+void ra8835_blit(const ra8835_t *dev, int x, int y, int w, int h,
+                 const uint8_t *src, size_t stride){
+    int x0 = (x < 0) ? 0 : x;
+    int y0 = (y < 0) ? 0 : y;
+    int x1 = (x + w > _cols(dev)) ? _cols(dev) : x + w;   /* exclusive */
+    int y1 = (y + h > dev->rows) ? dev->rows : y + h;
+    size_t n = (w + 7) / 8;     /* bytes per source row */
+    unsigned cpl = _cpl(dev);
+    unsigned bl, br;            /* first and last byte column */
+    uint8_t ml, mr;             /* pixels of those bytes inside the rectangle */
+    
+    if( w <= 0 || h <= 0 || x0 >= x1 || y0 >= y1 ){
+        return;
+    }
+    bl = x0 / 8;
+    br = (x1 - 1) / 8;
+    ml = 0xFF >> (x0 % 8);
+    mr = 0xFF << (7 - (x1 - 1) % 8);
+    if( bl == br ){
+        ml &= mr;
+    }
+    
+    if( _deferred(dev) ){
+        for(int r = y0; r < y1; r++){
+            const uint8_t *row = src + (r - y) * stride;
+            
+            for(unsigned bx = bl; bx <= br; bx++){
+                uint8_t mask = (bx == bl) ? ml : (bx == br) ? mr : 0xFF;
+                
+                _fb_merge(dev, r, bx, mask, _src_bits(row, n, bx * 8 - x));
+            }
+        }
+        return;
+    }
+    
+    /* Edge bytes that are only partly covered need read-modify-write */
+    if( ml != 0xFF || bl == br ){
+        _blit_column(dev, bl, ml, y0, y1, src, x, y, n, stride);
+        if( bl++ == br ){
+            return;
+        }
+    }
+    if( mr != 0xFF ){
+        _blit_column(dev, br, mr, y0, y1, src, x, y, n, stride);
+        br--;
+    }
+    if( bl > br ){
+        return;
+    }
+    
+    /* Fully covered bytes are simply overwritten, one burst per row */
+    _cmd(dev, _gfx_dir(dev));
+    for(int r = y0; r < y1; r++){
+        const uint8_t *row = src + (r - y) * stride;
+        
+        _set_cursor(dev, _gfx_addr(dev, r * cpl + bl));
+        _begin(dev, RA8835_MWRITE);
+        if( x % 8 == 0 ){
+            row += (bl * 8 - x) / 8;
+            for(unsigned bx = bl; bx <= br; bx++){
+                _cycle(dev, _gfx_byte(dev, *row++));
+            }
+        }
+        else {
+            for(unsigned bx = bl; bx <= br; bx++){
+                _cycle(dev, _gfx_byte(dev, _src_bits(row, n, bx * 8 - x)));
+            }
+        }
+        _end(dev);
+    }
+}
+
+int ra8835_draw_page(ra8835_t *dev, unsigned page){
+    if( page >= _gfx_pages(dev) ){
+        return -EINVAL;
+    }
+    dev->page = page;
+    if( dev->fb ){
+        /* The shadow holds the old page, all of it has to go to the new one */
+        for(unsigned y = 0; y < dev->rows; y++){
+            dev->fb->lo[y] = 0;
+            dev->fb->hi[y] = _cpl(dev);
+        }
+    }
+    return 0;
+}
+
+/* Read the layer drawn to back into the shadow */
+static void _fb_load(const ra8835_t *dev){
+    ra8835_fb_t *fb = dev->fb;
+    size_t len = dev->rows * _cpl(dev);
+    
+    _cmd(dev, _gfx_dir(dev));
+    _set_cursor(dev, _gfx_addr(dev, 0));
+    _read_burst(dev, RA8835_MREAD, fb->pix, len);
+    if( dev->upside_down ){
+        for(size_t i = 0; i < len; i++){
+            fb->pix[i] = reverse[fb->pix[i]];
+        }
+    }
+    memset(fb->hi, 0, sizeof(fb->hi));
+}
+
+int ra8835_draw_layer(ra8835_t *dev, unsigned layer){
+    if( layer < 1 || layer > 3 || (layer != 2 && !_three(dev)) ){
+        return -EINVAL;
+    }
+    if( layer == dev->layer ){
+        return 0;
+    }
+    if( dev->fb ){
+        ra8835_flush(dev);
+        dev->layer = layer;
+        _fb_load(dev);
+        return 0;
+    }
+    dev->layer = layer;
+    return 0;
+}
+
+int ra8835_show_page(ra8835_t *dev, unsigned page){
+    if( page >= _gfx_pages(dev) ){
+        return -EINVAL;
+    }
+    return ra8835_scroll(dev, page * dev->rows);
+}
+
+int ra8835_scroll(ra8835_t *dev, unsigned line){
+    if( line > (_gfx_pages(dev) - 1) * dev->rows ){
+        return -EINVAL;
+    }
+    dev->scroll = line;
+    _scroll_setup(dev);
+    return 0;
+}
+
+int ra8835_hscroll(ra8835_t *dev, unsigned x){
+    unsigned old = _hscroll(dev);
+    uint8_t hdot;
+    
+    if( x > (unsigned)(_cols(dev) - dev->cols) ){
+        return -EINVAL;
+    }
+    dev->hscroll = x;
+    if( _hscroll(dev) / 8 != old / 8 ){
+        _scroll_setup(dev);
+    }
+    hdot = _hscroll(dev) % 8;
+    if( hdot != old % 8 ){
+        ra8835_write_burst(dev, RA8835_HDOT_SCR, &hdot, 1);
+    }
+    return 0;
+}
+
+/* Copy len bytes to display RAM at offset of the region at addr, size long.
+   Upside-down regions are stored turned around like the layers are. */
+static void _vram_put(const ra8835_t *dev, uint16_t addr, size_t size,
+                      size_t offset, const uint8_t *buf, size_t len){
+    if( !dev->upside_down ){
+        _cmd(dev, RA8835_CSRDIR_RIGHT);
+        _set_cursor(dev, addr + offset);
+        ra8835_write_burst(dev, RA8835_MWRITE, buf, len);
+        return;
+    }
+    _cmd(dev, RA8835_CSRDIR_LEFT);
+    _set_cursor(dev, addr + size - 1 - offset);
+    _begin(dev, RA8835_MWRITE);
+    while( len-- ){
+        _cycle(dev, reverse[*buf++]);
+    }
+    _end(dev);
+}
+
+/* The reverse of _vram_put() */
+static void _vram_get(const ra8835_t *dev, uint16_t addr, size_t size,
+                      size_t offset, uint8_t *buf, size_t len){
+    _cmd(dev, dev->upside_down ? RA8835_CSRDIR_LEFT : RA8835_CSRDIR_RIGHT);
+    _set_cursor(dev, dev->upside_down ? addr + size - 1 - offset : addr + offset);
+    _read_burst(dev, RA8835_MREAD, buf, len);
+    if( dev->upside_down ){
+        for(size_t i = 0; i < len; i++){
+            buf[i] = reverse[buf[i]];
+        }
+    }
+}
+
+/* First fit in the free region around the bitmaps already there */
+static int _sprite_place(const ra8835_t *dev, const ra8835_sprite_cache_t *cache,
+                         size_t size, uint16_t *addr){
+    const ra8835_region_t *free = &dev->map.region[RA8835_MAP_FREE];
+    const ra8835_sprite_slot_t *slot = cache->slot;
+    
+    /* Candidates are the start of the region and the end of each bitmap */
+    for(int i = -1; i < (int)CONFIG_RA8835_SPRITE_SLOTS; i++){
+        size_t at = free->addr;
+        int fits = 1;
+        
+        if( i >= 0 ){
+            if( slot[i].src == NULL ){
+                continue;
+            }
+            at = slot[i].addr + slot[i].size;
+        }
+        if( at + size > (size_t)free->addr + free->size ){
+            continue;
+        }
+        for(unsigned j = 0; j < CONFIG_RA8835_SPRITE_SLOTS; j++){
+            if( slot[j].src && at < slot[j].addr + slot[j].size
+                && slot[j].addr < at + size ){
+                fits = 0;
+                break;
+            }
+        }
+        if( fits ){
+            *addr = at;
+            return 0;
+        }
+    }
+    return -ENOMEM;
+}
+
+int ra8835_sprite_load(const ra8835_t *dev, ra8835_sprite_cache_t *cache,
+                       const uint8_t *src, size_t size){
+    ra8835_sprite_slot_t *slot = cache->slot;
+    uint16_t addr;
+    int i;
+    
+    cache->tick++;
+    for(i = 0; i < (int)CONFIG_RA8835_SPRITE_SLOTS; i++){
+        if( slot[i].src == src && slot[i].size == size ){
+            slot[i].used = cache->tick;
+            cache->hits++;
+            return i;
+        }
+    }
+    cache->misses++;
+    if( size == 0 || size > dev->map.region[RA8835_MAP_FREE].size ){
+        return -ENOMEM;
+    }
+    
+    while(1){
+        int lru = -1;
+        
+        for(i = 0; i < (int)CONFIG_RA8835_SPRITE_SLOTS; i++){
+            if( slot[i].src == NULL ){
+                break;
+            }
+        }
+        if( i < (int)CONFIG_RA8835_SPRITE_SLOTS && _sprite_place(dev, cache, size, &addr) == 0 ){
+            break;
+        }
+        
+        /* No room, drop the bitmap unused for the longest time */
+        for(int j = 0; j < (int)CONFIG_RA8835_SPRITE_SLOTS; j++){
+            if( slot[j].src && !slot[j].pinned &&
+                (lru < 0 || cache->tick - slot[j].used > cache->tick - slot[lru].used) ){
+                lru = j;
+            }
+        }
+        if( lru < 0 ){
+            return -ENOMEM;
+        }
+        slot[lru].src = NULL;
+        cache->evictions++;
+    }
+    
+    slot[i].src = src;
+    slot[i].addr = addr;
+    slot[i].size = size;
+    slot[i].used = cache->tick;
+    slot[i].pinned = 0;
+    _vram_put(dev, addr, size, 0, src, size);
+    return i;
+}
+
+int ra8835_sprite_draw(const ra8835_t *dev, ra8835_sprite_cache_t *cache,
+                       int x, int y, int w, int h, const uint8_t *src){
+    size_t stride = (w + 7) / 8;
+    uint32_t hits = cache->hits;
+    uint8_t buf[RA8835_RUN_MAX];
+    const ra8835_sprite_slot_t *slot;
+    int i;
+    
+    if( w <= 0 || h <= 0 ){
+        return 0;
+    }
+    i = ra8835_sprite_load(dev, cache, src, stride * h);
+    if( i < 0 ){
+        return i;
+    }
+    if( cache->hits == hits ){
+        /* Just uploaded, the bytes are at hand anyway */
+        ra8835_blit(dev, x, y, w, h, src, stride);
+        return 0;
+    }
+    
+    /* Read back as many whole rows as the buffer holds, so the edges are
+       still merged in column runs */
+    slot = &cache->slot[i];
+    if( stride <= sizeof(buf) ){
+        int k = sizeof(buf) / stride;
+        
+        for(int r = 0; r < h; r += k){
+            int n = (h - r < k) ? h - r : k;
+            
+            _vram_get(dev, slot->addr, slot->size, r * stride, buf, n * stride);
+            ra8835_blit(dev, x, y + r, w, n, buf, stride);
+        }
+        return 0;
+    }
+    
+    /* Wider ones row by row, in pieces as wide as the buffer */
+    for(int r = 0; r < h; r++){
+        for(size_t c = 0; c < stride; c += sizeof(buf)){
+            size_t n = (stride - c < sizeof(buf)) ? stride - c : sizeof(buf);
+            int cw = (w - (int)c * 8 < (int)sizeof(buf) * 8) ? w - (int)c * 8
+                                                              : (int)sizeof(buf) * 8;
+            
+            _vram_get(dev, slot->addr, slot->size, r * stride + c, buf, n);
+            ra8835_blit(dev, x + c * 8, y + r, cw, 1, buf, n);
+        }
+    }
+    return 0;
+}
+
+int ra8835_sprite_forget(ra8835_sprite_cache_t *cache, const uint8_t *src){
+    for(int i = 0; i < (int)CONFIG_RA8835_SPRITE_SLOTS; i++){
+        if( cache->slot[i].src == src ){
+            if( cache->slot[i].pinned ){
+                return -EBUSY;
+            }
+            cache->slot[i].src = NULL;
+        }
+    }
+    return 0;
+}
+
+int ra8835_sprite_strip(ra8835_t *dev, ra8835_sprite_cache_t *cache,
+                        const uint8_t *src, unsigned lines){
+    int i = -1;
+    
+    if( lines >= dev->rows ){
+        return -EINVAL;
+    }
+    if( lines ){
+        i = ra8835_sprite_load(dev, cache, src, lines * _cpl(dev));
+        if( i < 0 ){
+            return i;
+        }
+    }
+    for(int j = 0; j < (int)CONFIG_RA8835_SPRITE_SLOTS; j++){
+        cache->slot[j].pinned = (j == i);
+    }
+    dev->strip = lines ? cache->slot[i].addr : 0;
+    dev->strip_lines = lines;
+    _scroll_setup(dev);
+    return 0;
+}
+
+void ra8835_set_mix(ra8835_t *dev, ra8835_mix_t mix){
+    dev->mix = mix;
+    _ovlay_setup(dev);
+}
+
+void ra8835_flush(const ra8835_t *dev){
+    ra8835_fb_t *fb = dev->fb;
+    unsigned cpl = _cpl(dev);
+    size_t next = SIZE_MAX;     /* where the open MWRITE would continue */
+    uint32_t t0 = _stats_start(dev);
+    
+    if( fb == NULL ){
+        if( dev->dl ){
+            _dl_replay(dev);
+            _stats_stop(dev, RA8835_STATS_FLUSH, t0);
+        }
+        return;
+    }
+    
+    for(unsigned y = 0; y < dev->rows; y++){
+        size_t start, stop;
+        
+        if( fb->hi[y] == 0 ){
+            continue;
+        }
+        start = y * cpl + fb->lo[y];
+        stop = y * cpl + fb->hi[y];
+        
+        /* A span starting where the last one ended needs no new cursor */
+        if( start != next ){
+            if( next == SIZE_MAX ){
+                _cmd(dev, _gfx_dir(dev));
+            } else {
+                _end(dev);
+            }
+            _set_cursor(dev, _gfx_addr(dev, start));
+            _begin(dev, RA8835_MWRITE);
+        }
+        for(size_t i = start; i < stop; i++){
+            _cycle(dev, _gfx_byte(dev, fb->pix[i]));
+        }
+        next = stop;
+        fb->hi[y] = 0;
+    }
+    if( next != SIZE_MAX ){
+        _end(dev);
+    }
+    _stats_stop(dev, RA8835_STATS_FLUSH, t0);
+}
+
+/* Display bytes touched by a line, gathered into runs for _gfx_run() */
+typedef struct {
+    int bx, by;                 /* first byte */
+    int sx, sy;                 /* step to the next byte, one of them 0 */
+    unsigned len;
+    uint8_t mask[RA8835_RUN_MAX];
+} _run_t;
+
+static void _run_flush(const ra8835_t *dev, _run_t *run){
+    if( run->len ){
+        _gfx_run(dev, run->bx, run->by, run->sx, run->sy, run->mask, run->len,
+                 RA8835_PIXEL_SET);
+        run->len = 0;
+    }
+}
+
+static void _run_add(const ra8835_t *dev, _run_t *run, int bx, int by, uint8_t mask){
+    int nx = run->bx + (int)run->len * run->sx;
+    int ny = run->by + (int)run->len * run->sy;
+    
+    if( run->len == 1 ){
+        /* The second byte sets the direction, if it is a neighbour */
+        run->sx = (by == run->by && abs(bx - run->bx) == 1) ? bx - run->bx : 0;
+        run->sy = (bx == run->bx && abs(by - run->by) == 1) ? by - run->by : 0;
+        nx = run->bx + run->sx;
+        ny = run->by + run->sy;
+    }
+    if( run->len == 0 || run->len == RA8835_RUN_MAX ||
+        (run->sx == 0 && run->sy == 0) || bx != nx || by != ny ){
+        _run_flush(dev, run);
+        run->bx = bx;
+        run->by = by;
+        run->sx = run->sy = 0;
+    }
+    run->mask[run->len++] = mask;
+}
+
+void ra8835_line(const ra8835_t *dev, int x1, int y1, int x2, int y2){
+    uint32_t t0 = _stats_start(dev);
+    int dx = abs(x2 - x1);
+    int dy = -abs(y2 - y1);
+    int sx = (x1 < x2) ? 1 : -1;
+    int sy = (y1 < y2) ? 1 : -1;
+    int err = dx + dy;
+    int bx = -1, by = -1;       /* display byte the mask belongs to */
+    uint8_t mask = 0;
+    _run_t run = { .len = 0 };
+    
+    /* Bresenham, collecting pixels until the line leaves the display byte.
+       Steep lines then give runs of bytes stacked in a column, shallow ones
+       runs along a row, and each run costs one read and one write burst
+       with the cursor moving along */
+    while(1){
+        int e2 = 2 * err;
+        
+        if( (unsigned)x1 < (unsigned)_cols(dev) && (unsigned)y1 < dev->rows ){
+            if( x1 / 8 != bx || y1 != by ){
+                if( mask ){
+                    _run_add(dev, &run, bx, by, mask);
+                }
+                bx = x1 / 8;
+                by = y1;
+                mask = 0;
+            }
+            mask |= 0x80 >> (x1 % 8);
+        }
+        if( x1 == x2 && y1 == y2 ){
+            break;
+        }
+        if( e2 >= dy ){
+            err += dy;
+            x1 += sx;
+        }
+        if( e2 <= dx ){
+            err += dx;
+            y1 += sy;
+        }
+    }
+    if( mask ){
+        _run_add(dev, &run, bx, by, mask);
+    }
+    _run_flush(dev, &run);
+    _stats_stop(dev, RA8835_STATS_LINE, t0);
+}
+
+void ra8835_async_init(ra8835_async_t *as, const ra8835_t *dev){
+    memset(as, 0, sizeof(*as));
+    as->dev = dev;
+    /* Used as a signal: unlocked by the end of a transfer, taken by the
+       waiter, see ra8835_async_wait() */
+    mutex_init(&as->done);
+    mutex_lock(&as->done);
+}
+
+int ra8835_async_queue(ra8835_async_t *as, uint16_t addr, const uint8_t *buf,
+                       size_t len){
+    if( as->busy ){
+        return -EBUSY;
+    }
+    if( as->num >= CONFIG_RA8835_ASYNC_QUEUE ){
+        return -ENOMEM;
+    }
+    if( len == 0 ){
+        return -EINVAL;
+    }
+    as->xfer[as->num].buf = buf;
+    as->xfer[as->num].len = len;
+    as->xfer[as->num].addr = addr;
+    as->num++;
+    return 0;
+}
+
+#if !CONFIG_RA8835_SIM
+static void _async_tick(void *arg){
+    ra8835_async_step(arg);
+}
+#endif
+
+int ra8835_async_start(ra8835_async_t *as, ra8835_async_cb_t cb, void *arg){
+    if( as->busy ){
+        return -EBUSY;
+    }
+    as->cb = cb;
+    as->arg = arg;
+    as->cur = 0;
+    as->pos = 0;
+    as->busy = 1;
+#if !CONFIG_RA8835_SIM
+    as->timer.callback = _async_tick;
+    as->timer.arg = as;
+#endif
+    
+    /* Nobody else touches the bus until done, so the direction set here
+       and the cursor left by one chunk still hold for the next */
+    _cmd(as->dev, RA8835_CSRDIR_RIGHT);
+    ra8835_async_step(as);
+    return 0;
+}
+
+int ra8835_async_step(ra8835_async_t *as){
+    const ra8835_t *dev = as->dev;
+    size_t budget = CONFIG_RA8835_ASYNC_CHUNK;
+    
+    if( !as->busy ){
+        return 0;
+    }
+    while( budget && (as->cur < as->num) ){
+        const ra8835_xfer_t *x = &as->xfer[as->cur];
+        size_t n = x->len - as->pos;
+        
+        if( n > budget ){
+            n = budget;
+        }
+        if( as->pos == 0 ){
+            _set_cursor(dev, x->addr);
+        }
+        ra8835_write_burst(dev, RA8835_MWRITE, x->buf + as->pos, n);
+        as->pos += n;
+        budget -= n;
+        if( as->pos == x->len ){
+            as->cur++;
+            as->pos = 0;
+        }
+    }
+    if( as->cur < as->num ){
+#if !CONFIG_RA8835_SIM
+        xtimer_set(&as->timer, CONFIG_RA8835_ASYNC_PERIOD_US);
+#endif
+        return 1;
+    }
+    
+    /* Done before the callback, which may start the next transfer */
+    as->num = 0;
+    as->busy = 0;
+    mutex_unlock(&as->done);
+    if( as->cb ){
+        as->cb(as->arg);
+    }
+    return 0;
+}
+
+void ra8835_async_wait(ra8835_async_t *as){
+#if CONFIG_RA8835_SIM
+    while( ra8835_async_step(as) ){}
+#else
+    /* Each end of a transfer unlocks it once, an end that came before
+       the lock lets it through right away */
+    while( as->busy ){
+        mutex_lock(&as->done);
+    }
+#endif
+}
+
+int ra8835_write_img_async(ra8835_async_t *as, const uint8_t img[],
+                           ra8835_async_cb_t cb, void *arg){
+    size_t len = as->dev->rows * _cpl(as->dev);
+    int res = ra8835_async_queue(as, _native_addr(as->dev, len), img, len);
+    
+    if( res < 0 ){
+        return res;
+    }
+    return ra8835_async_start(as, cb, arg);
+}
+
+#if CONFIG_RA8835_STATS
+void ra8835_stats_dump(const ra8835_t *dev){
+    static const char *const names[RA8835_STATS_NUMOF] = {
+        "write_img", "line", "text_print", "clear", "flush",
+    };
+    const ra8835_stats_t *st = dev->stats;
+    
+    if( st == NULL ){
+        return;
+    }
+    printf("ra8835: %" PRIu32 " bytes, %" PRIu32 " commands, %" PRIu32
+           " cursor moves, %" PRIu32 " bytes read\n",
+           st->bytes, st->cmds, st->cursor_moves, st->reads);
+    for(unsigned i = 0; i < RA8835_STATS_NUMOF; i++){
+        const ra8835_stats_call_t *call = &st->call[i];
+        
+        if( call->count == 0 ){
+            continue;
+        }
+        printf("%-10s %6" PRIu32 " calls, min %" PRIu32 " us, mean %" PRIu32
+               " us, max %" PRIu32 " us\n", names[i], call->count, call->min_us,
+               (uint32_t)(call->total_us / call->count), call->max_us);
+        for(unsigned b = 0; b < CONFIG_RA8835_STATS_BINS; b++){
+            if( call->hist[b] == 0 ){
+                continue;
+            }
+            if( b == CONFIG_RA8835_STATS_BINS - 1 ){
+                printf("%10s >= %" PRIu32 " us: %" PRIu32 "\n", "",
+                       (uint32_t)1 << b, call->hist[b]);
+            } else {
+                printf("%10s  < %" PRIu32 " us: %" PRIu32 "\n", "",
+                       (uint32_t)2 << b, call->hist[b]);
+            }
+        }
+    }
+}
+#endif
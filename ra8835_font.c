@@ -1,2318 +1,34 @@
 #include <stdint.h>
 
+#include "ra8835.h"
+
 /* Cyrillic CG font, like S03 in MELT displays */
 /* See "Making a Glyph from Bit Patterns" from Expert C Programming */
 #define X )*2+1
 #define _ )*2
 #define s ((((((((0 /* For building glyphs 8 bits wide */
+#define GLYPH(r0, r1, r2, r3, r4, r5, r6, r7) r0, r1, r2, r3, r4, r5, r6, r7
 
 const uint8_t ra8835_font[] = {
-    /* 0x00 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x01 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x02 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x03 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x04 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x05 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x06 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x07 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x08 */
-    s X X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x09 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s X _ X _ X _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x0A */
-    s _ _ _ _ X _ _ _,
-    s _ _ _ X X _ _ _,
-    s _ X X _ X _ _ _,
-    s _ X X _ X _ _ _,
-    s _ X X _ X _ _ _,
-    s _ _ _ X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x0B */
-    s _ _ X X _ _ _ _,
-    s _ X X X X _ _ _,
-    s _ X X X X _ _ _,
-    s _ X X X X _ _ _,
-    s _ X X X X _ _ _,
-    s _ X X X X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x0C */
-    s _ _ X X _ _ _ _,
-    s _ X X X X _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s _ X X X X _ _ _,
-    s _ X X X X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x0D*/
-    s _ _ X X _ _ _ _,
-    s _ X X X X _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s _ X X X X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x0E */
-    s _ _ X X _ _ _ _,
-    s _ X X X X _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x0F */
-    s _ _ X X _ _ _ _,
-    s _ X X X X _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x10 */
-    s X _ _ _ X _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s _ X _ _ X _ _ _,
-    s X _ _ X X _ _ _,
-    s _ _ X _ X _ _ _,
-    s _ _ X X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    /* 0x11 */
-    s X _ _ _ X _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s _ X _ X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ _ X X _ _ _,
-    /* 0x12 */
-    s X _ _ _ X _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s _ X _ X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ X X _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ X X _ _ _,
-    /* 0x13 */
-    s X X _ _ _ _ _ _,
-    s _ X _ _ X _ _ _,
-    s X X _ X _ _ _ _,
-    s _ X X _ X _ _ _,
-    s X X _ X X _ _ _,
-    s X _ X _ X _ _ _,
-    s _ _ X X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    /* 0x14 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x15 */
-    s _ _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x16 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X X _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x17 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ _ X _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x18 */
-    s _ _ X _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ X X X _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x19 */
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x1A */
-    s _ _ _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x1B */
-    s _ X _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x1C */
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ _ X X _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    /* 0x1D */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X X _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X X X _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ _ _ _ _,
-    /* 0x1E */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ X _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x1F */
-    s _ _ _ _ _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x20 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x21 */
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x22 */
-    s _ X _ X _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x23 */
-    s _ X _ X _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s X X X X X _ _ _,
-    s _ X _ X _ _ _ _,
-    s X X X X X _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x24 */
-    s _ _ X _ _ _ _ _,
-    s _ X X X X _ _ _,
-    s X _ X _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ X _ X _ _ _,
-    s X X X X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x25 */
-    s X X _ _ _ _ _ _,
-    s X X _ _ X _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s X _ _ X X _ _ _,
-    s _ _ _ X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x26 */
-    s _ X X _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ _ X _ _ _ _,
-    s _ X X _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x27 */
-    s _ X X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x28 */
-    s _ _ _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x29 */
-    s _ X _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x2A */
-    s _ _ _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s X _ X _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ X _ X _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x2B */
-    s _ _ _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x2C */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    /* 0x2D */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x2E */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x2F */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x30 */
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ X X _ _ _,
-    s X _ X _ X _ _ _,
-    s X X _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x31 */
-    s _ _ X _ _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x32 */
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x33 */
-    s X X X X X _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x34 */
-    s _ _ _ X _ _ _ _,
-    s _ _ X X _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x35 */
-    s X X X X X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X X X X _ _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x36 */
-    s _ _ X X _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x37 */
-    s X X X X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x38 */
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x39 */
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x3A */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x3B */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    /* 0x3C */
-    s _ _ _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x3D */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x3E */
-    s _ X _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x3F */
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x40 */
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ X X X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X X X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x41 */
-    s _ _ X _ _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x42 */
-    s X X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x43 */
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x44 */
-    s X X X _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ X _ _ _ _,
-    s X X X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x45 */
-    s X X X X X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X X X X _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x46 */
-    s X X X X X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X X X X _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x47 */
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x48 */
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x49 */
-    s _ X X X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x4A */
-    s _ _ X X X _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x4B */
-    s X _ _ _ X _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s X X _ _ _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x4C */
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x4D */
-    s X _ _ _ X _ _ _,
-    s X X _ X X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x4E */
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X _ _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ _ X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x4F */
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x50 */
-    s X X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x51 */
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ _ X _ _ _ _,
-    s _ X X _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x52 */
-    s X X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x53 */
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x54 */
-    s X X X X X _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x55 */
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x56 */
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x57 */
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x58 */
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x59 */
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x5A */
-    s X X X X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x5B */
-    s _ _ X X X _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x5C */
-    s _ _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x5D */
-    s X X X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s X X X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x5E */
-    s _ _ X _ _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x5F */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x60 */
-    s _ X X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x61 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x62 */
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ X X _ _ _ _,
-    s X X _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x63 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x64 */
-    s _ _ _ _ X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ X X _ X _ _ _,
-    s X _ _ X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x65 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x66 */
-    s _ _ X X _ _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X _ _ _ _ _ _,
-    s X X X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x67 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    /* 0x68 */
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ X X _ _ _ _,
-    s X X _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x69 */
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x6A */
-    s _ _ _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ X X _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s _ X X _ _ _ _ _,
-    /* 0x6B */
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s X X _ _ _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x6C */
-    s _ X X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x6D */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X _ X _ _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x6E */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ X X _ _ _ _,
-    s X X _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x6F */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x70 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ X X _ _ _ _,
-    s X X _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    /* 0x71 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X _ X _ _ _,
-    s X _ _ X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ _ _ X _ _ _,
-    /* 0x72 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ X X _ _ _ _,
-    s X X _ _ X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x73 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x74 */
-    s _ X _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s X X X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ _ X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x75 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ X X _ _ _,
-    s _ X X _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x76 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x77 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x78 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x79 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    /* 0x7A */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x7B */
-    s _ _ _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x7C */
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x7D */
-    s _ X _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x7E */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X _ _ X _ _ _,
-    s X _ X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x7F */
-    s X X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ X X X _ _ _,
-    s X _ X X _ _ _ _,
-    s X X X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x80 */
-    s _ _ X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ X X _ _ _ _,
-    s _ _ X X _ _ _ _,
-    s _ _ X X _ _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x81 */
-    s _ X _ _ _ _ _ _,
-    s X X _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s X X X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x82 */
-    s X X X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s X X X _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X X X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x83 */
-    s X X X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s X X X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x84 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x85 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ X _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x86 */
-    s _ _ X _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ X _ X _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x87 */
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s X _ X _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x88 */
-    s _ _ X X _ _ _ _,
-    s _ X _ _ X _ _ _,
-    s X X X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s X X X _ _ _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ _ X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x89 */
-    s X _ _ _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ X X _ _ _ _,
-    s X X X X X _ _ _,
-    s X _ X X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x8A */
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s X X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x8B */
-    s _ X X X X _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s X X X X _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x8C */
-    s X _ _ _ X _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s X X _ _ _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s X _ _ X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ X _ _ _,
-    /* 0x8D */
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X X X X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    /* 0x8E */
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x8F */
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x90 */
-    s _ _ _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x91 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ X X _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ X X _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x92 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x93 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x94 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ X _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x95 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x96 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x97 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x98 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    /* 0x99 */
-    s _ _ _ _ X _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X X _ X _ _ _,
-    s X X X X X _ _ _,
-    s _ X X _ X _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x9A */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ X _ _ _,
-    s X X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x9B */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s X X X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0x9C */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s X X _ _ _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s X _ _ X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    /* 0x9D */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X X X X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    /* 0x9E */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    /* 0x9F */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xA0 */
-    s X X X X X _ _ _,
-    s X X X X X _ _ _,
-    s X X X X X _ _ _,
-    s X X X X X _ _ _,
-    s X X X X X _ _ _,
-    s X X X X X _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xA1 */
-    s _ X _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xA2 */
-    s _ _ _ _ _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    /* 0xA3 */
-    s _ _ X X _ _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X _ _ _ _ _ _,
-    s X X X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xA4 */
-    s X _ _ X _ _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xA5 */
-    s X _ _ _ X _ _ _,
-    s _ X _ X _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ X _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xA6 */
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xA7 */
-    s _ _ X X _ _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s _ X X _ _ _ _ _,
-    /* 0xA8 */
-    s _ X _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X X X X _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xA9 */
-    s _ X X X _ _ _ _,
-    s X X _ X X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X X X _ _ _,
-    s X _ X _ X _ _ _,
-    s X X _ X X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xAA */
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X X X _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xAB */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ _ X _ _ _,
-    s X _ _ X _ _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xAC */
-    s _ _ _ _ X _ _ _,
-    s _ _ X _ X _ _ _,
-    s _ X _ _ X _ _ _,
-    s X X X X X _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xAD */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xAE */
-    s _ X X X _ _ _ _,
-    s X _ _ X X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ _ X X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xAF */
-    s _ X _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xB0 */
-    s _ X X _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xB1 */
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xB2 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s X X X X X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xB3 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xB4 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X _ _ X _ _ _,
-    s X _ _ X _ _ _ _,
-    s X X _ X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xB5 */
-    s X X _ X X _ _ _,
-    s _ X _ _ X _ _ _,
-    s X _ _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xB6 */
-    s _ X X X X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s _ X X _ X _ _ _,
-    s _ _ X _ X _ _ _,
-    s _ _ X _ X _ _ _,
-    s _ _ X _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xB7 */
-    s _ _ _ X _ _ _ _,
-    s _ _ X _ X _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    /* 0xB8 */
-    s _ X _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xB9 */
-    s _ _ _ _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X X X _ X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    /* 0xBA */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xBB */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s _ X _ _ X _ _ _,
-    s X _ _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xBC */
-    s _ _ X _ _ _ _ _,
-    s _ _ X X _ _ _ _,
-    s _ _ X _ X _ _ _,
-    s _ _ X _ X _ _ _,
-    s _ _ X _ _ _ _ _,
-    s X X X _ _ _ _ _,
-    s X X X _ _ _ _ _,
-    s X X _ _ _ _ _ _,
-    /* 0xBD */
-    s _ _ X _ _ _ _ _,
-    s _ _ X X _ _ _ _,
-    s X _ X _ X _ _ _,
-    s _ X X _ X _ _ _,
-    s _ _ X _ _ _ _ _,
-    s X X X X _ _ _ _,
-    s X X X _ X _ _ _,
-    s X X _ _ _ _ _ _,
-    /* 0xBE */
-    s _ _ _ X _ _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s _ _ X _ X _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xBF */
-    s _ _ _ _ _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xC0 */
-    s _ _ X X X _ _ _,
-    s _ X _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xC1 */
-    s X X X X X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xC2 */
-    s X X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xC3 */
-    s X X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xC4 */
-    s _ _ X X _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s X X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    /* 0xC5 */
-    s X X X X X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X X X X _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xC6 */
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xC7 */
-    s X X X X _ _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s X X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xC8 */
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ X X _ _ _,
-    s X _ X _ X _ _ _,
-    s X X _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xC9 */
-    s _ _ X _ _ _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ X X _ _ _,
-    s X _ X _ X _ _ _,
-    s X X _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xCA */
-    s X _ _ _ X _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s X X _ _ _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xCB */
-    s _ _ _ X X _ _ _,
-    s _ _ X _ X _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xCC */
-    s X _ _ _ X _ _ _,
-    s X X _ X X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xCD */
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xCE */
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xCF */
-    s X X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xD0 */
-    s X X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xD1 */
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xD2 */
-    s X X X X X _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xD3 */
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xD4 */
-    s _ _ X _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xD5 */
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xD6 */
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    /* 0xD7 */
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xD8 */
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xD9 */
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    /* 0xDA */
-    s X X _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xDB */
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X _ _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X X _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xDC */
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X X X _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X X X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xDD */
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ _ X X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xDE */
-    s X _ _ X _ _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X X X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xDF */
-    s _ X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ X _ X _ _ _,
-    s _ X _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xE0 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xE1 */
-    s _ _ _ X _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xE2 */
-    s _ X X _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s X X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xE3 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X X X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xE4 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ X X _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s X X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    /* 0xE5 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X X _ _ _,
-    s X _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xE6 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xE7 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X X _ _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ X X _ _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s X X X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xE8 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ X X _ _ _,
-    s X _ X _ X _ _ _,
-    s X X _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xE9 */
-    s _ _ _ _ _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ X X _ _ _,
-    s X _ X _ X _ _ _,
-    s X X _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xEA */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s X X _ _ _ _ _ _,
-    s X _ X _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xEB */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ X X _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xEC */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X _ X X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xED */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xEE */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xEF */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xF0 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X X _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    /* 0xF1 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xF2 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xF3 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    /* 0xF4 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    /* 0xF5 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X _ X _ _ _ _,
-    s _ _ X _ _ _ _ _,
-    s _ X _ X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xF6 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    /* 0xF7 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xF8 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xF9 */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X X X X X _ _ _,
-    s _ _ _ _ X _ _ _,
-    /* 0xFA */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X X _ _ _ _ _ _,
-    s _ X _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xFB */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s X _ _ _ X _ _ _,
-    s X X X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X X _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xFC */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X _ _ _ _ _ _ _,
-    s X X X _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X X X _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xFD */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X _ _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ _ X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xFE */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s X _ _ X _ _ _ _,
-    s X _ X _ X _ _ _,
-    s X X X _ X _ _ _,
-    s X _ X _ X _ _ _,
-    s X _ _ X _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    /* 0xFF */
-    s _ _ _ _ _ _ _ _,
-    s _ _ _ _ _ _ _ _,
-    s _ X X X X _ _ _,
-    s X _ _ _ X _ _ _,
-    s _ X X X X _ _ _,
-    s _ _ X _ X _ _ _,
-    s _ X _ _ X _ _ _,
-    s _ _ _ _ _ _ _ _,
+#include "ra8835_font.inc"
+};
+
+#if CONFIG_RA8835_FLIPPED_FONT
+/* Same glyphs for upside-down displays: each row is built LSB first, so the
+   leftmost pixel ends up in bit 0, and the rows go bottom to top */
+#undef X
+#undef _
+#undef GLYPH
+#define X )/2+128
+#define _ )/2
+#define GLYPH(r0, r1, r2, r3, r4, r5, r6, r7) r7, r6, r5, r4, r3, r2, r1, r0
+
+const uint8_t ra8835_font_flipped[] = {
+#include "ra8835_font.inc"
 };
+#endif
 
 #undef X
 #undef _
-#undef s
\ No newline at end of file
+#undef s
+#undef GLYPH
@@ -0,0 +1,486 @@
+/**
+ * @ingroup     drivers_ra8835
+ *
+ * @{
+ * @file
+ * @brief       Host-side bus simulator for the RA8835 graphic LCD
+ *
+ * Models the controller as seen through the 8080 style bus: bytes are
+ * latched on the rising edge of ~WR while ~CS is low, A0 selects between
+ * command and parameter/data. While ~RD is low the controller drives the
+ * status flag (A0 low) or the result of MREAD/CSRR (A0 high). Only the parts of the command set the driver
+ * uses are decoded.
+ *
+ * @author      Alexander Podshivalov <a_podshivalov@mail.ru>
+ *
+ * @}
+ */
+
+#include "ra8835.h"
+
+#if CONFIG_RA8835_SIM
+
+#include <assert.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ra8835_internal.h"
+#include "ra8835_sim.h"
+
+#define VRAM_MASK       (RA8835_SIM_VRAM_SIZE - 1)
+#define ROW_MAX         (256)       /* bytes per rendered row, CR is 8 bit */
+
+static struct {
+    const ra8835_t *dev;
+    uint8_t vram[RA8835_SIM_VRAM_SIZE];
+    /* Line levels as driven by the MCU */
+    uint8_t wr, rd, cs, a0, rst;
+    uint8_t data;
+    uint8_t out;                /* driven by the controller during reads */
+    /* Command decoder */
+    uint8_t cmd;
+    uint8_t idx;
+    /* Registers */
+    uint8_t sysset[8];
+    uint8_t scroll[10];
+    uint8_t csrform[2];
+    uint8_t cgram[2];
+    uint8_t hdot;
+    uint8_t ovlay;
+    uint8_t disp_on;
+    uint8_t disp_attr;
+    uint16_t csr;
+    uint8_t csrdir;
+    /* Bus timing, on a clock that is not affected by ra8835_sim_reset_stats() */
+    uint64_t now;
+    uint64_t t_wr_fall;
+    uint64_t t_rd_fall;
+    uint64_t t_prev_fall;
+    uint64_t t_data;
+    ra8835_sim_stats_t stats;
+} _sim;
+
+static void _elapse(uint64_t ns){
+    _sim.now += ns;
+    _sim.stats.time_ns += ns;
+}
+
+static void _reset(void){
+    _sim.cmd = 0;
+    _sim.idx = 0;
+    memset(_sim.sysset, 0, sizeof(_sim.sysset));
+    memset(_sim.scroll, 0, sizeof(_sim.scroll));
+    memset(_sim.csrform, 0, sizeof(_sim.csrform));
+    memset(_sim.cgram, 0, sizeof(_sim.cgram));
+    _sim.hdot = 0;
+    _sim.ovlay = 0;
+    _sim.disp_on = 0;
+    _sim.disp_attr = 0;
+    _sim.csr = 0;
+    _sim.csrdir = RA8835_CSRDIR_RIGHT;
+}
+
+static uint16_t _ap(void){
+    return _sim.sysset[6] | (_sim.sysset[7] << 8);
+}
+
+static uint16_t _sad(unsigned block){
+    /* SAD1 at P1, SAD2 at P4, SAD3 at P7, SAD4 at P9 */
+    static const uint8_t pos[] = { 0, 3, 6, 8 };
+    return _sim.scroll[pos[block]] | (_sim.scroll[pos[block] + 1] << 8);
+}
+
+static void _advance(void){
+    switch( _sim.csrdir ){
+        case RA8835_CSRDIR_RIGHT: _sim.csr += 1; break;
+        case RA8835_CSRDIR_LEFT:  _sim.csr -= 1; break;
+        case RA8835_CSRDIR_UP:    _sim.csr -= _ap(); break;
+        case RA8835_CSRDIR_DOWN:  _sim.csr += _ap(); break;
+    }
+}
+
+static void _store(uint8_t *reg, size_t len, uint8_t value){
+    if( _sim.idx < len ){
+        reg[_sim.idx] = value;
+    }
+}
+
+static void _command(uint8_t cmd){
+    _sim.cmd = cmd;
+    _sim.idx = 0;
+    _sim.stats.cmd_bytes++;
+
+    switch( cmd ){
+        case RA8835_CSRDIR_RIGHT:
+        case RA8835_CSRDIR_LEFT:
+        case RA8835_CSRDIR_UP:
+        case RA8835_CSRDIR_DOWN:
+            _sim.csrdir = cmd;
+            break;
+        case RA8835_DISPLAY_ON:
+            _sim.disp_on = 1;
+            break;
+        case RA8835_DISPLAY_OFF:
+            _sim.disp_on = 0;
+            break;
+    }
+}
+
+static void _data(uint8_t value){
+    _sim.stats.data_bytes++;
+
+    switch( _sim.cmd ){
+        case RA8835_SYSTEM_SET:
+            _store(_sim.sysset, sizeof(_sim.sysset), value);
+            break;
+        case RA8835_SCROLL:
+            _store(_sim.scroll, sizeof(_sim.scroll), value);
+            break;
+        case RA8835_CSRFORM:
+            _store(_sim.csrform, sizeof(_sim.csrform), value);
+            break;
+        case RA8835_CGRAM_ADR:
+            _store(_sim.cgram, sizeof(_sim.cgram), value);
+            break;
+        case RA8835_HDOT_SCR:
+            _sim.hdot = value & 0x07;
+            break;
+        case RA8835_OVLAY:
+            _sim.ovlay = value & 0x1F;
+            break;
+        case RA8835_DISPLAY_ON:
+        case RA8835_DISPLAY_OFF:
+            _sim.disp_attr = value;
+            break;
+        case RA8835_CSRW:
+            if( _sim.idx == 0 ){
+                _sim.csr = (_sim.csr & 0xFF00) | value;
+            } else if( _sim.idx == 1 ){
+                _sim.csr = (_sim.csr & 0x00FF) | (value << 8);
+            }
+            break;
+        case RA8835_MWRITE:
+            _sim.vram[_sim.csr & VRAM_MASK] = value;
+            _advance();
+            break;
+        default:
+            break;
+    }
+    if( _sim.idx < 0xFF ){
+        _sim.idx++;
+    }
+}
+
+static void _check_timing(void){
+    if( (_sim.now - _sim.t_wr_fall < RA8835_T_CC_NS) ||
+        (_sim.now - _sim.t_data < RA8835_T_DS8_NS) ){
+        _sim.stats.timing_violations++;
+    }
+}
+
+static void _strobe(void){
+    _check_timing();
+    _sim.stats.bus_cycles++;
+    if( _sim.a0 ){
+        _command(_sim.data);
+    } else {
+        _data(_sim.data);
+    }
+}
+
+/* What the controller puts on the bus when ~RD goes low */
+static uint8_t _output(void){
+    if( !_sim.a0 ){
+        /* Status flag, never busy */
+        return 0x00;
+    }
+    switch( _sim.cmd ){
+        case RA8835_MREAD:
+            return _sim.vram[_sim.csr & VRAM_MASK];
+        case RA8835_CSRR:
+            return (_sim.idx == 0) ? (_sim.csr & 0xFF) : (_sim.csr >> 8);
+        default:
+            return 0xFF;
+    }
+}
+
+static void _read_done(void){
+    if( _sim.now - _sim.t_rd_fall < RA8835_T_CC_NS ){
+        _sim.stats.timing_violations++;
+    }
+    _sim.stats.bus_cycles++;
+    _sim.stats.read_bytes++;
+    if( !_sim.a0 ){
+        return;
+    }
+    if( _sim.cmd == RA8835_MREAD ){
+        _advance();
+    } else if( (_sim.cmd == RA8835_CSRR) && (_sim.idx < 0xFF) ){
+        _sim.idx++;
+    }
+}
+
+static void _cycle_start(void){
+    if( _sim.now - _sim.t_prev_fall < RA8835_T_CYC8_NS ){
+        _sim.stats.timing_violations++;
+    }
+    _sim.t_prev_fall = _sim.now;
+}
+
+/* Data sampled by the MCU, valid tACC8 after ~RD went low */
+static uint8_t _sample(void){
+    if( _sim.rd || _sim.cs ){
+        return 0;
+    }
+    if( _sim.now - _sim.t_rd_fall < RA8835_T_ACC8_NS ){
+        _sim.stats.timing_violations++;
+    }
+    return _sim.out;
+}
+
+void ra8835_sim_attach(const ra8835_t *dev){
+    _sim.dev = dev;
+    _sim.wr = _sim.rd = _sim.cs = _sim.rst = 1;
+    _sim.a0 = 0;
+    _sim.data = 0;
+    _sim.t_wr_fall = _sim.t_rd_fall = _sim.t_prev_fall = _sim.t_data = 0;
+    _sim.now = RA8835_T_CYC8_NS;
+    _reset();
+}
+
+void ra8835_sim_pin_write(gpio_t pin, int value){
+    const ra8835_t *dev = _sim.dev;
+    uint8_t level = value ? 1 : 0;
+
+    assert(dev);
+
+    _sim.stats.gpio_ops++;
+    _elapse(CONFIG_RA8835_SIM_GPIO_NS);
+
+    if( pin == dev->wr ){
+        if( _sim.wr && !level ){
+            _cycle_start();
+            _sim.t_wr_fall = _sim.now;
+        }
+        /* Bytes are latched on the rising edge */
+        if( !_sim.wr && level && !_sim.cs && _sim.rst ){
+            _strobe();
+        }
+        _sim.wr = level;
+    } else if( pin == dev->rd ){
+        if( _sim.rd && !level ){
+            _cycle_start();
+            _sim.t_rd_fall = _sim.now;
+            _sim.out = _output();
+        }
+        if( !_sim.rd && level && !_sim.cs && _sim.rst ){
+            _read_done();
+        }
+        _sim.rd = level;
+    } else if( pin == dev->cs ){
+        _sim.cs = level;
+    } else if( pin == dev->a0 ){
+        _sim.a0 = level;
+    } else if( pin == dev->rst ){
+        if( !level ){
+            _reset();
+        }
+        _sim.rst = level;
+    } else {
+        for( unsigned i = 0; i < 8; i++ ){
+            if( pin == dev->data[i] ){
+                _sim.data = (_sim.data & ~(1 << i)) | (level << i);
+                _sim.t_data = _sim.now;
+                break;
+            }
+        }
+    }
+}
+
+void ra8835_sim_pin_init(gpio_t pin, gpio_mode_t mode){
+    (void)pin;
+    (void)mode;
+    _sim.stats.gpio_ops++;
+    _elapse(CONFIG_RA8835_SIM_GPIO_NS);
+}
+
+int ra8835_sim_pin_read(gpio_t pin){
+    const ra8835_t *dev = _sim.dev;
+
+    _sim.stats.gpio_ops++;
+    _elapse(CONFIG_RA8835_SIM_GPIO_NS);
+    for( unsigned i = 0; i < 8; i++ ){
+        if( pin == dev->data[i] ){
+            return (_sample() >> i) & 0x01;
+        }
+    }
+    return 0;
+}
+
+uint8_t ra8835_sim_port_read(void){
+    _sim.stats.gpio_ops++;
+    _elapse(CONFIG_RA8835_SIM_PORT_NS);
+    return _sample();
+}
+
+void ra8835_sim_port_write(uint8_t value){
+    _sim.stats.gpio_ops++;
+    _elapse(CONFIG_RA8835_SIM_PORT_NS);
+    _sim.data = value;
+    _sim.t_data = _sim.now;
+}
+
+void ra8835_sim_delay_ns(uint32_t ns){
+    _elapse(ns);
+}
+
+void ra8835_sim_sleep_us(uint32_t us){
+    _elapse((uint64_t)us * 1000 + CONFIG_RA8835_SIM_SLEEP_OVERHEAD_NS);
+}
+
+void ra8835_sim_get_stats(ra8835_sim_stats_t *stats){
+    *stats = _sim.stats;
+}
+
+void ra8835_sim_reset_stats(void){
+    memset(&_sim.stats, 0, sizeof(_sim.stats));
+}
+
+const uint8_t *ra8835_sim_vram(void){
+    return _sim.vram;
+}
+
+static unsigned _width(void){
+    return (_sim.sysset[3] + 1) * 8;
+}
+
+static unsigned _height(void){
+    return _sim.sysset[5] + 1;
+}
+
+/* Fetch one display byte of a screen block, as seen after HDOT_SCR */
+static uint8_t _fetch(uint16_t sad, int text, unsigned line, unsigned x){
+    unsigned fy = (_sim.sysset[2] & 0x0F) + 1;
+    unsigned col = x + _sim.hdot;
+    uint16_t addr;
+    uint8_t value;
+
+    if( !text ){
+        addr = sad + line * _ap() + col / 8;
+        value = _sim.vram[addr & VRAM_MASK];
+    } else {
+        uint16_t sag = _sim.cgram[0] | (_sim.cgram[1] << 8);
+        uint8_t code;
+
+        addr = sad + (line / fy) * _ap() + col / 8;
+        code = _sim.vram[addr & VRAM_MASK];
+        value = _sim.vram[(sag + code * 8 + line % fy) & VRAM_MASK];
+    }
+
+    return (value >> (7 - col % 8)) & 0x01;
+}
+
+static uint8_t _layer_pixel(ra8835_sim_layer_t layer, unsigned x, unsigned y){
+    int three = _sim.ovlay & 0x10;
+    int text1 = !(_sim.ovlay & 0x04);
+    int text3 = !(_sim.ovlay & 0x08);
+    unsigned sl1 = _sim.scroll[2];
+    unsigned sl2 = _sim.scroll[5];
+
+    switch( layer ){
+        case RA8835_SIM_LAYER1:
+            if( y <= sl1 ){
+                return _fetch(_sad(0), text1, y, x);
+            }
+            return three ? 0 : _fetch(_sad(2), text3, y - sl1 - 1, x);
+        case RA8835_SIM_LAYER2:
+            if( y <= sl2 ){
+                return _fetch(_sad(1), 0, y, x);
+            }
+            return _fetch(_sad(3), 0, y - sl2 - 1, x);
+        case RA8835_SIM_LAYER3:
+            return three ? _fetch(_sad(2), text3, y, x) : 0;
+        default:
+            return 0;
+    }
+}
+
+static uint8_t _composite_pixel(unsigned x, unsigned y){
+    int three = _sim.ovlay & 0x10;
+    uint8_t attr1, l1, l2, l3;
+
+    if( !_sim.disp_on ){
+        return 0;
+    }
+
+    /* Attribute 00 blanks a screen block, anything else shows it.
+     * Below SL1 layer 1 continues in block 3, which has its own attribute */
+    attr1 = (!three && y > _sim.scroll[2]) ? 0xC0 : 0x0C;
+    l1 = (_sim.disp_attr & attr1) ? _layer_pixel(RA8835_SIM_LAYER1, x, y) : 0;
+    l2 = (_sim.disp_attr & 0x30) ? _layer_pixel(RA8835_SIM_LAYER2, x, y) : 0;
+    l3 = (three && (_sim.disp_attr & 0xC0)) ? _layer_pixel(RA8835_SIM_LAYER3, x, y) : 0;
+
+    switch( _sim.ovlay & 0x03 ){
+        case 0x01: return (l1 ^ l2) | l3;    /* XOR */
+        case 0x02: return (l1 & l2) | l3;    /* AND */
+        default:   return l1 | l2 | l3;      /* OR, priority OR */
+    }
+}
+
+static void _render_row(ra8835_sim_layer_t layer, unsigned y, uint8_t *row){
+    unsigned width = _width();
+
+    memset(row, 0, (width + 7) / 8);
+    for( unsigned x = 0; x < width; x++ ){
+        uint8_t p = (layer == RA8835_SIM_COMPOSITE) ? _composite_pixel(x, y)
+                                                    : _layer_pixel(layer, x, y);
+        row[x / 8] |= p << (7 - x % 8);
+    }
+}
+
+int ra8835_sim_render(ra8835_sim_layer_t layer, uint8_t *buf, size_t size){
+    size_t stride = (_width() + 7) / 8;
+
+    if( stride * _height() > size ){
+        return -ENOBUFS;
+    }
+    for( unsigned y = 0; y < _height(); y++ ){
+        _render_row(layer, y, buf + y * stride);
+    }
+
+    return stride * _height();
+}
+
+int ra8835_sim_dump_pbm(const char *path, ra8835_sim_layer_t layer){
+    uint8_t row[ROW_MAX];
+    size_t stride = (_width() + 7) / 8;
+    FILE *f;
+    int res = 0;
+
+    if( stride > sizeof(row) ){
+        return -ENOBUFS;
+    }
+
+    f = fopen(path, "wb");
+    if( f == NULL ){
+        return -EIO;
+    }
+    fprintf(f, "P4\n%u %u\n", _width(), _height());
+    for( unsigned y = 0; y < _height(); y++ ){
+        _render_row(layer, y, row);
+        if( fwrite(row, 1, stride, f) != stride ){
+            res = -EIO;
+            break;
+        }
+    }
+    if( fclose(f) != 0 ){
+        res = -EIO;
+    }
+
+    return res;
+}
+
+#else
+typedef int dont_be_pedantic;
+#endif /* CONFIG_RA8835_SIM */
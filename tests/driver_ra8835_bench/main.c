@@ -0,0 +1,337 @@
+/**
+ * @ingroup     tests
+ *
+ * @{
+ * @file
+ * @brief       Bus traffic of the RA8835 drawing paths on the simulator
+ *
+ * Runs the same workloads the plain way and the optimized way and prints
+ * the bus bytes, and for the pin bus the simulated time, of both:
+ *
+ * - a full screen picture, ra8835_write_img() against the run-length coded
+ *   ra8835_write_img_rle()
+ * - clearing the graphics layer byte by byte against ra8835_clear()
+ * - a frame of mixed drawing calls sent directly, through a display list
+ *   and through a shadow
+ * - text and lines without and with a ra8835_ctl_t attached
+ * - redrawing status lines with ra8835_text_print() against
+ *   ra8835_text_update() and ra8835_text_printf() with a text shadow
+ *
+ * Both ways have to leave the same picture, the application prints
+ * SUCCESS if they all do and no strobe broke the datasheet timing.
+ *
+ * picture_rle.c is the picture of the example application, converted with
+ * tools/ra8835_img.py --rle --name picture_rle picture.pbm picture_rle.c
+ *
+ * @author      Alexander Podshivalov <a_podshivalov@mail.ru>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ra8835.h"
+#include "ra8835_sim.h"
+
+#define COLS        (320U)
+#define ROWS        (240U)
+#define SIZE        (COLS * ROWS / 8)
+
+extern const uint8_t picture_rle[];
+extern const size_t picture_rle_size;
+
+static ra8835_t dev = {
+    .cols = COLS,
+    .rows = ROWS,
+    .wr = GPIO_PIN(0, 0),
+    .rd = GPIO_PIN(0, 1),
+    .cs = GPIO_PIN(0, 2),
+    .a0 = GPIO_PIN(0, 3),
+    .rst = GPIO_PIN(0, 4),
+    .data = {
+        GPIO_PIN(1, 0), GPIO_PIN(1, 1), GPIO_PIN(1, 2), GPIO_PIN(1, 3),
+        GPIO_PIN(1, 4), GPIO_PIN(1, 5), GPIO_PIN(1, 6), GPIO_PIN(1, 7),
+    },
+};
+
+static ra8835_fb_t fb;
+static ra8835_dl_op_t ops[1024];
+static ra8835_dl_t dl = { .ops = ops };
+static ra8835_ctl_t ctl;
+static ra8835_text_t text;
+
+static char picture[SIZE];
+static uint8_t ref[SIZE], shown[SIZE];
+static ra8835_sim_stats_t mark;
+static int failed;
+
+static const uint8_t sprite[] = { 0xFF, 0x81, 0x81, 0xA5, 0x81, 0xFF, 0x3C, 0x42 };
+
+/* Set up the display with the given helpers attached */
+static void _init(ra8835_bus_t bus, ra8835_fb_t *f, ra8835_dl_t *l, ra8835_ctl_t *c,
+                  ra8835_text_t *t){
+    dev.bus = bus;
+    dev.fb = f;
+    dev.dl = l;
+    dev.ctl = c;
+    dev.text = t;
+    ra8835_init(&dev);
+}
+
+static void _start(void){
+    ra8835_sim_get_stats(&mark);
+}
+
+static unsigned _bytes(void){
+    ra8835_sim_stats_t now;
+    
+    ra8835_sim_get_stats(&now);
+    return (now.cmd_bytes - mark.cmd_bytes) + (now.data_bytes - mark.data_bytes) +
+           (now.read_bytes - mark.read_bytes);
+}
+
+static unsigned _us(void){
+    ra8835_sim_stats_t now;
+    
+    ra8835_sim_get_stats(&now);
+    return (now.time_ns - mark.time_ns) / 1000;
+}
+
+static void _keep(void){
+    ra8835_sim_render(RA8835_SIM_COMPOSITE, ref, SIZE);
+}
+
+/* Compare the screen with the one kept by _keep() */
+static const char *_same(void){
+    ra8835_sim_render(RA8835_SIM_COMPOSITE, shown, SIZE);
+    if( memcmp(ref, shown, SIZE) ){
+        failed = 1;
+        return "DIFFERENT PICTURE";
+    }
+    return "same picture";
+}
+
+static void _unpack(void){
+    size_t pos = 0;
+    
+    for(size_t i = 0; i < picture_rle_size;){
+        uint8_t c = picture_rle[i++];
+    
+        if( c & RA8835_RLE_REPEAT ){
+            memset(&picture[pos], picture_rle[i++], (c & 0x7F) + 2);
+            pos += (c & 0x7F) + 2;
+        } else {
+            memcpy(&picture[pos], &picture_rle[i], c + 1);
+            pos += c + 1;
+            i += c + 1;
+        }
+    }
+}
+
+static void _picture(void){
+    unsigned b, t;
+    
+    puts("picture, pin bus:");
+    _init(RA8835_BUS_PIN, NULL, NULL, NULL, NULL);
+    _start();
+    ra8835_write_img(&dev, picture);
+    b = _bytes();
+    t = _us();
+    _keep();
+    printf("  write_img       %6u bytes %6u us\n", b, t);
+    
+    ra8835_clear(&dev);
+    _start();
+    ra8835_write_img_rle(&dev, picture_rle, picture_rle_size);
+    b = _bytes();
+    t = _us();
+    printf("  write_img_rle   %6u bytes %6u us, %s, %u byte stream\n", b, t, _same(),
+           (unsigned)picture_rle_size);
+}
+
+static void _clear(void){
+    static const char blank[SIZE];
+    unsigned t;
+    
+    puts("clear graphics layer, pin bus:");
+    _init(RA8835_BUS_PIN, NULL, NULL, NULL, NULL);
+    ra8835_write_img(&dev, picture);
+    _start();
+    ra8835_write_img(&dev, blank);
+    t = _us();
+    _keep();
+    printf("  byte by byte    %6u us\n", t);
+    
+    ra8835_write_img(&dev, picture);
+    _start();
+    ra8835_clear(&dev);
+    t = _us();
+    printf("  clear           %6u us, %s\n", t, _same());
+}
+
+static void _frame_draw(int k){
+    for(int i = 0; i < 8; i++){
+        ra8835_line(&dev, 10 + i * 30, 5, 300 - i * 20, 200 + k);
+    }
+    for(int i = 0; i < 6; i++){
+        ra8835_rect(&dev, 5 + i * 50, 100, 40, 30 + k, RA8835_PIXEL_SET);
+    }
+    ra8835_fill_rect(&dev, 33, 150, 120, 20, RA8835_PIXEL_TOGGLE);
+    ra8835_fill_rect(&dev, 160, 150, 100, 40, RA8835_PIXEL_SET);
+    ra8835_fill_rect(&dev, 170, 160, 50, 10, RA8835_PIXEL_CLEAR);
+    for(int i = 0; i < 100; i++){
+        ra8835_pixel(&dev, (i * 37) % 320, (i * 53) % 240,
+                     (i % 3 == 0) ? RA8835_PIXEL_TOGGLE : RA8835_PIXEL_SET);
+    }
+    for(int i = 0; i < 10; i++){
+        ra8835_blit(&dev, 3 + i * 31, 220, 8, 8, sprite, 1);
+    }
+    ra8835_hline(&dev, 0, 239, 320, RA8835_PIXEL_SET);
+    ra8835_vline(&dev, 319, 0, 240, RA8835_PIXEL_TOGGLE);
+    ra8835_flush(&dev);
+}
+
+/* Two frames drawn over the picture, the display list relies on the
+   controller state to chain its runs */
+static unsigned _frames(ra8835_fb_t *f, ra8835_dl_t *l){
+    _init(RA8835_BUS_PORT, f, l, &ctl, NULL);
+    ra8835_write_img(&dev, picture);
+    ra8835_flush(&dev);
+    _start();
+    _frame_draw(0);
+    _frame_draw(7);
+    return _bytes();
+}
+
+static void _frame(void){
+    unsigned b;
+    
+    puts("two frames of mixed drawing, bytes per frame:");
+    b = _frames(NULL, NULL);
+    _keep();
+    printf("  direct          %6u\n", b / 2);
+    dl.size = 1024;
+    b = _frames(NULL, &dl);
+    printf("  display list    %6u, 1024 entries, %s\n", b / 2, _same());
+    dl.size = 37;
+    b = _frames(NULL, &dl);
+    printf("  display list    %6u, 37 entries, %s\n", b / 2, _same());
+    b = _frames(&fb, NULL);
+    printf("  shadow          %6u, %s\n", b / 2, _same());
+}
+
+static void _ctl_run(ra8835_ctl_t *c, unsigned *b){
+    _init(RA8835_BUS_PORT, NULL, NULL, c, NULL);
+    _start();
+    for(uint8_t row = 0; row < 30; row++){
+        ra8835_text_set_cursor(&dev, 0, row);
+        ra8835_text_print(&dev, "T=");
+        ra8835_text_print(&dev, "23.5");
+        ra8835_text_print(&dev, " C  ");
+        ra8835_text_write(&dev, '!');
+    }
+    b[0] = _bytes();
+    _start();
+    for(uint8_t row = 0; row < 30; row++){
+        ra8835_text_set_cursor(&dev, 20, row);
+        ra8835_text_print(&dev, "x");
+        ra8835_text_set_cursor(&dev, 21, row);
+        ra8835_text_print(&dev, "y");
+    }
+    b[1] = _bytes();
+    _start();
+    for(int i = 0; i < 20; i++){
+        ra8835_line(&dev, 0, i * 10, 319, 239 - i * 10);
+    }
+    b[2] = _bytes();
+}
+
+static void _ctl(void){
+    unsigned before[3], after[3];
+    
+    puts("controller state, bytes without and with a ra8835_ctl_t:");
+    _ctl_run(NULL, before);
+    _keep();
+    _ctl_run(&ctl, after);
+    printf("  text            %6u %6u\n", before[0], after[0]);
+    printf("  set_cursor      %6u %6u\n", before[1], after[1]);
+    printf("  lines           %6u %6u, %s\n", before[2], after[2], _same());
+}
+
+/* 30 status lines where a few digits change from one redraw to the next */
+static void _status(int k, int update){
+    char line[48];
+    
+    for(int row = 0; row < 30; row++){
+        snprintf(line, sizeof(line), "Sensor %2d: %5d.%d C  ok %c", row,
+                 100 + row * 3 + (k % 3 == 0 && row % 7 == 0), (k + row) % 10,
+                 "-+"[k & 1]);
+        if( update ){
+            ra8835_text_update(&dev, 0, row, line);
+        } else {
+            ra8835_text_set_cursor(&dev, 0, row);
+            ra8835_text_print(&dev, line);
+        }
+    }
+}
+
+static unsigned _printf_run(ra8835_text_t *t){
+    _init(RA8835_BUS_PORT, NULL, NULL, &ctl, t);
+    _start();
+    for(int k = 0; k < 10; k++){
+        for(uint8_t row = 10; row < 28; row++){
+            ra8835_text_printf(&dev, 0, row, "Sensor %2d: %5d.%d C  %s", row,
+                               100 + row * 3 + (k % 3 == 0 && row % 7 == 0),
+                               (k + row) % 10, (k & 1) ? "ok " : "---");
+        }
+    }
+    return _bytes();
+}
+
+static void _text(void){
+    unsigned b;
+    
+    puts("status screen redrawn 11 times, bytes:");
+    _init(RA8835_BUS_PORT, NULL, NULL, &ctl, NULL);
+    _start();
+    for(int k = 0; k < 11; k++){
+        _status(k, 0);
+    }
+    b = _bytes();
+    _keep();
+    printf("  text_print      %6u\n", b);
+    _init(RA8835_BUS_PORT, NULL, NULL, &ctl, &text);
+    _start();
+    for(int k = 0; k < 11; k++){
+        _status(k, 1);
+    }
+    b = _bytes();
+    printf("  text_update     %6u, %s\n", b, _same());
+    
+    puts("180 status lines with text_printf, bytes:");
+    b = _printf_run(NULL);
+    _keep();
+    printf("  no shadow       %6u\n", b);
+    b = _printf_run(&text);
+    printf("  text shadow     %6u, %s\n", b, _same());
+}
+
+int main(void){
+    ra8835_sim_stats_t stats;
+    
+    _unpack();
+    _picture();
+    _clear();
+    _frame();
+    _ctl();
+    _text();
+    
+    ra8835_sim_get_stats(&stats);
+    if( stats.timing_violations ){
+        printf("%u timing violations\n", (unsigned)stats.timing_violations);
+        failed = 1;
+    }
+    puts(failed ? "FAILURE" : "SUCCESS");
+    return failed;
+}
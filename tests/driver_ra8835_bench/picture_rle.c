@@ -0,0 +1,434 @@
+/* Generated by tools/ra8835_img.py from picture.pbm, do not edit */
+#include <stddef.h>
+#include <stdint.h>
+
+const uint8_t picture_rle[5123] = {
+    0x8C, 0x00, 0x05, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0xC0, 0x83, 0x00, 0x03,
+    0x0C, 0x00, 0x07, 0xC7, 0x81, 0x00, 0x00, 0x07, 0x93, 0x00, 0x05, 0x0F,
+    0x8C, 0x00, 0x3F, 0x00, 0xC0, 0x83, 0x00, 0x03, 0x0E, 0x00, 0x01, 0xE7,
+    0x81, 0x00, 0x03, 0x07, 0x00, 0x00, 0x70, 0x8E, 0x00, 0x07, 0x70, 0x00,
+    0x3E, 0x0E, 0x00, 0x7C, 0x00, 0xC0, 0x83, 0x00, 0x03, 0x0E, 0x00, 0x00,
+    0xFE, 0x81, 0x00, 0x04, 0x1F, 0x7F, 0xFF, 0xFF, 0xC0, 0x8D, 0x00, 0x07,
+    0x78, 0x00, 0xF8, 0x06, 0x03, 0xE0, 0x00, 0x80, 0x83, 0x00, 0x03, 0x06,
+    0x00, 0x00, 0x3E, 0x81, 0x00, 0x00, 0x1F, 0x81, 0xFF, 0x00, 0xF0, 0x8D,
+    0x00, 0x07, 0x7E, 0x01, 0xE0, 0x06, 0x07, 0x00, 0x01, 0x80, 0x83, 0x00,
+    0x03, 0x06, 0x00, 0x00, 0x1E, 0x81, 0x00, 0x07, 0x7F, 0xC0, 0x00, 0x00,
+    0x30, 0x00, 0xFF, 0xF0, 0x8A, 0x00, 0x07, 0xFE, 0x03, 0x80, 0x03, 0x1E,
+    0x00, 0x01, 0x80, 0x83, 0x00, 0x03, 0x06, 0x00, 0x00, 0x0C, 0x81, 0x00,
+    0x00, 0xFC, 0x81, 0x00, 0x03, 0x18, 0x07, 0xFF, 0xFF, 0x8A, 0x00, 0x07,
+    0xEF, 0x07, 0x00, 0x03, 0x38, 0x00, 0x03, 0x80, 0x82, 0x00, 0x01, 0x0F,
+    0x87, 0x84, 0x00, 0x00, 0xE0, 0x81, 0x00, 0x03, 0x18, 0x0F, 0xC0, 0xFF,
+    0x8A, 0x00, 0x06, 0xC7, 0x8E, 0x00, 0x03, 0xF0, 0x00, 0x03, 0x83, 0x00,
+    0x01, 0x1F, 0xEF, 0x88, 0x00, 0x03, 0x18, 0x3C, 0x00, 0x07, 0x89, 0x00,
+    0x09, 0x01, 0xC3, 0x9C, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x0F, 0xC0, 0x81,
+    0x00, 0x02, 0x1F, 0xFF, 0x80, 0x87, 0x00, 0x01, 0x18, 0xF0, 0x8B, 0x00,
+    0x0F, 0x01, 0x81, 0xF8, 0x00, 0x01, 0x80, 0x00, 0x0F, 0xFF, 0xC1, 0xFF,
+    0x80, 0x00, 0x18, 0x3F, 0xC0, 0x87, 0x00, 0x01, 0x7F, 0xC0, 0x8B, 0x00,
+    0x0F, 0x03, 0x80, 0xF8, 0x00, 0x03, 0x80, 0x00, 0x0F, 0xF7, 0x8F, 0xFF,
+    0x80, 0x00, 0x18, 0x1F, 0xC0, 0x87, 0x00, 0x00, 0xFF, 0x8C, 0x00, 0x0F,
+    0x03, 0x00, 0xF8, 0x00, 0x03, 0x80, 0x00, 0x3F, 0x83, 0x3F, 0x81, 0x80,
+    0x00, 0x0C, 0x07, 0xE0, 0x86, 0x00, 0x01, 0x01, 0xFC, 0x89, 0x00, 0x12,
+    0x1F, 0xF7, 0xF8, 0x03, 0x00, 0x78, 0x00, 0x03, 0x80, 0x00, 0x3E, 0x07,
+    0xFC, 0x01, 0x80, 0x00, 0x0C, 0x01, 0xF0, 0x87, 0x00, 0x00, 0xF0, 0x89,
+    0x00, 0x05, 0x1F, 0xFF, 0xFF, 0xC3, 0x00, 0x78, 0x82, 0x00, 0x08, 0x78,
+    0x07, 0xF0, 0x01, 0x80, 0x00, 0x0E, 0x00, 0xF0, 0x93, 0x00, 0x05, 0x1F,
+    0xE0, 0x07, 0xF7, 0x00, 0x30, 0x82, 0x00, 0x06, 0xF0, 0x0F, 0xC0, 0x03,
+    0x80, 0x00, 0x0F, 0x95, 0x00, 0x05, 0x0C, 0x00, 0x00, 0xFF, 0x00, 0x30,
+    0x82, 0x00, 0x07, 0xC0, 0x0F, 0x80, 0x03, 0x03, 0xFF, 0xFF, 0x80, 0x94,
+    0x00, 0x03, 0x0C, 0x00, 0x00, 0x1F, 0x85, 0x00, 0x06, 0x0E, 0x00, 0x03,
+    0x0F, 0xFF, 0xFF, 0x80, 0x94, 0x00, 0x04, 0x0C, 0x00, 0x00, 0x0F, 0x80,
+    0x84, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x1E, 0x00, 0x07, 0xC0, 0x94, 0x00,
+    0x04, 0x0E, 0x00, 0x00, 0x03, 0x80, 0x86, 0x00, 0x04, 0x0E, 0x3C, 0x00,
+    0x01, 0xC0, 0x94, 0x00, 0x00, 0x06, 0x8A, 0x00, 0x01, 0x0C, 0x3C, 0x97,
+    0x00, 0x00, 0x06, 0x8A, 0x00, 0x01, 0x0F, 0xFE, 0x97, 0x00, 0x00, 0x07,
+    0x8A, 0x00, 0x01, 0x1F, 0xFE, 0x97, 0x00, 0x00, 0x03, 0x8A, 0x00, 0x01,
+    0x3F, 0x07, 0x97, 0x00, 0x01, 0x01, 0x80, 0x89, 0x00, 0x02, 0x18, 0x03,
+    0xC0, 0x96, 0x00, 0x01, 0x01, 0xC0, 0x8B, 0x00, 0x00, 0xFF, 0x97, 0x00,
+    0x00, 0xF0, 0x8B, 0x00, 0x01, 0x7F, 0x80, 0x96, 0x00, 0x00, 0xF8, 0x8B,
+    0x00, 0x01, 0x3F, 0x80, 0x95, 0x00, 0x01, 0xF1, 0xFF, 0x8B, 0x00, 0x00,
+    0x7E, 0x96, 0x00, 0x80, 0xFF, 0x8B, 0x00, 0x00, 0xE0, 0x96, 0x00, 0x00,
+    0x7F, 0x8B, 0x00, 0x01, 0x01, 0xC0, 0x96, 0x00, 0x00, 0x78, 0x8B, 0x00,
+    0x00, 0x03, 0x97, 0x00, 0x00, 0x38, 0x8B, 0x00, 0x00, 0x07, 0x85, 0x00,
+    0x01, 0x7F, 0x80, 0x8E, 0x00, 0x00, 0x1C, 0x8B, 0x00, 0x00, 0x06, 0x84,
+    0x00, 0x02, 0x07, 0xFF, 0xF0, 0x8E, 0x00, 0x00, 0x0F, 0x8B, 0x00, 0x00,
+    0x0C, 0x84, 0x00, 0x02, 0x1F, 0x80, 0x38, 0x8E, 0x00, 0x01, 0x07, 0xC0,
+    0x8A, 0x00, 0x00, 0x1C, 0x84, 0x00, 0x02, 0x7C, 0x00, 0x0C, 0x8E, 0x00,
+    0x02, 0x03, 0xFF, 0x80, 0x89, 0x00, 0x00, 0x1C, 0x83, 0x00, 0x03, 0x01,
+    0xE0, 0x00, 0x07, 0x8F, 0x00, 0x01, 0x7F, 0x80, 0x89, 0x00, 0x01, 0x7F,
+    0x80, 0x82, 0x00, 0x04, 0x03, 0x80, 0x00, 0x03, 0x80, 0x8E, 0x00, 0x00,
+    0x07, 0x8A, 0x00, 0x01, 0xFF, 0xE0, 0x82, 0x00, 0x04, 0x07, 0x00, 0x00,
+    0x01, 0x80, 0x8E, 0x00, 0x00, 0x06, 0x89, 0x00, 0x02, 0x03, 0xC0, 0xF0,
+    0x82, 0x00, 0x04, 0x0C, 0x00, 0x00, 0x01, 0xC0, 0x8E, 0x00, 0x00, 0x0E,
+    0x89, 0x00, 0x02, 0x07, 0x00, 0x38, 0x82, 0x00, 0x00, 0x18, 0x81, 0x00,
+    0x00, 0xC0, 0x8E, 0x00, 0x00, 0x1E, 0x89, 0x00, 0x02, 0x0E, 0x00, 0x1C,
+    0x82, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0xE0, 0x8D, 0x00, 0x01, 0x0F,
+    0xFF, 0x89, 0x00, 0x02, 0x1C, 0x00, 0x0C, 0x82, 0x00, 0x00, 0x30, 0x81,
+    0x00, 0x00, 0x60, 0x8D, 0x00, 0x02, 0x3F, 0xFF, 0xE0, 0x88, 0x00, 0x02,
+    0x31, 0xFF, 0x06, 0x82, 0x00, 0x00, 0x60, 0x81, 0x00, 0x00, 0x60, 0x8D,
+    0x00, 0x02, 0x78, 0x00, 0xF0, 0x88, 0x00, 0x02, 0x73, 0xFF, 0x86, 0x82,
+    0x00, 0x00, 0xE0, 0x81, 0x00, 0x00, 0x60, 0x8C, 0x00, 0x03, 0x01, 0xE0,
+    0x00, 0x30, 0x88, 0x00, 0x02, 0xE0, 0x03, 0x86, 0x82, 0x00, 0x00, 0xC0,
+    0x81, 0x00, 0x00, 0x30, 0x8C, 0x00, 0x01, 0x01, 0xC0, 0x8A, 0x00, 0x02,
+    0xE0, 0x01, 0xC3, 0x81, 0x00, 0x01, 0x01, 0xC0, 0x81, 0x00, 0x00, 0x30,
+    0x8C, 0x00, 0x01, 0x03, 0x80, 0x8A, 0x00, 0x02, 0xC0, 0x01, 0xC3, 0x81,
+    0x00, 0x01, 0x01, 0xC0, 0x81, 0x00, 0x00, 0x30, 0x8C, 0x00, 0x01, 0x03,
+    0x80, 0x8A, 0x00, 0x02, 0xC0, 0x01, 0xE3, 0x81, 0x00, 0x01, 0x01, 0x80,
+    0x81, 0x00, 0x00, 0x30, 0x8C, 0x00, 0x00, 0x03, 0x8B, 0x00, 0x02, 0xC0,
+    0x00, 0xE3, 0x81, 0x00, 0x01, 0x01, 0x80, 0x81, 0x00, 0x00, 0x30, 0x8B,
+    0x00, 0x01, 0x3F, 0xE3, 0x8B, 0x00, 0x02, 0xC0, 0x00, 0xE3, 0x81, 0x00,
+    0x01, 0x03, 0x80, 0x81, 0x00, 0x00, 0x30, 0x8A, 0x00, 0x02, 0x0F, 0xFF,
+    0xFF, 0x8B, 0x00, 0x02, 0xC0, 0x00, 0x63, 0x81, 0x00, 0x01, 0x03, 0x80,
+    0x81, 0x00, 0x00, 0x20, 0x8A, 0x00, 0x02, 0x0F, 0xFF, 0xFF, 0x8B, 0x00,
+    0x02, 0xC0, 0x00, 0x63, 0x81, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x20,
+    0x8A, 0x00, 0x02, 0x0E, 0x00, 0x0F, 0x8B, 0x00, 0x06, 0xC0, 0x00, 0x63,
+    0x00, 0x00, 0xFF, 0xFF, 0x82, 0x00, 0x00, 0x20, 0x8A, 0x00, 0x02, 0x0E,
+    0x00, 0x03, 0x8B, 0x00, 0x03, 0xC0, 0x00, 0x63, 0x7F, 0x81, 0xFF, 0x00,
+    0x80, 0x81, 0x00, 0x00, 0x60, 0x8A, 0x00, 0x00, 0x06, 0x8D, 0x00, 0x01,
+    0xE0, 0x01, 0x81, 0xFF, 0x01, 0x00, 0x01, 0x82, 0x00, 0x00, 0x60, 0x8A,
+    0x00, 0x00, 0x06, 0x8D, 0x00, 0x03, 0x70, 0x1F, 0xFF, 0x80, 0x85, 0x00,
+    0x00, 0x60, 0x8A, 0x00, 0x00, 0x03, 0x8D, 0x00, 0x02, 0x70, 0x3F, 0xE0,
+    0x86, 0x00, 0x00, 0xC0, 0x8A, 0x00, 0x01, 0x03, 0x80, 0x8C, 0x00, 0x01,
+    0x3C, 0xFC, 0x87, 0x00, 0x00, 0xC0, 0x8A, 0x00, 0x02, 0x01, 0xFB, 0xF0,
+    0x8B, 0x00, 0x01, 0x3F, 0xE0, 0x87, 0x00, 0x00, 0xC0, 0x8B, 0x00, 0x01,
+    0x7F, 0xE0, 0x8B, 0x00, 0x01, 0x1F, 0x80, 0x86, 0x00, 0x01, 0x01, 0x80,
+    0x8B, 0x00, 0x00, 0x7E, 0x8C, 0x00, 0x00, 0x1F, 0x87, 0x00, 0x01, 0x01,
+    0x80, 0x8B, 0x00, 0x00, 0xF0, 0x8C, 0x00, 0x00, 0x3C, 0x87, 0x00, 0x01,
+    0x03, 0x80, 0x8A, 0x00, 0x01, 0x01, 0xC0, 0x8C, 0x00, 0x00, 0x70, 0x87,
+    0x00, 0x00, 0x03, 0x8B, 0x00, 0x06, 0x03, 0x80, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFC, 0x86, 0x00, 0x01, 0x01, 0xC0, 0x87, 0x00, 0x00, 0x07, 0x8B, 0x00,
+    0x02, 0x07, 0x00, 0x01, 0x82, 0xFF, 0x00, 0xC0, 0x85, 0x00, 0x01, 0x03,
+    0x80, 0x87, 0x00, 0x00, 0x07, 0x8B, 0x00, 0x03, 0x06, 0x00, 0x0F, 0xC0,
+    0x81, 0x00, 0x00, 0xFE, 0x85, 0x00, 0x00, 0x07, 0x88, 0x00, 0x00, 0x0E,
+    0x8B, 0x00, 0x02, 0x0C, 0x00, 0x7E, 0x82, 0x00, 0x01, 0x1F, 0x80, 0x84,
+    0x00, 0x00, 0x0E, 0x88, 0x00, 0x00, 0x0E, 0x8B, 0x00, 0x02, 0x0C, 0x00,
+    0xC0, 0x83, 0x00, 0x00, 0xE0, 0x84, 0x00, 0x00, 0x1C, 0x88, 0x00, 0x00,
+    0x1C, 0x8B, 0x00, 0x01, 0x1C, 0x0F, 0x84, 0x00, 0x00, 0x3C, 0x84, 0x00,
+    0x00, 0x70, 0x88, 0x00, 0x00, 0x1E, 0x8B, 0x00, 0x01, 0x18, 0x78, 0x84,
+    0x00, 0x00, 0x07, 0x84, 0x00, 0x00, 0xE0, 0x88, 0x00, 0x01, 0x0F, 0xC0,
+    0x8A, 0x00, 0x01, 0x1D, 0xE0, 0x84, 0x00, 0x01, 0x03, 0x80, 0x82, 0x00,
+    0x02, 0x01, 0xC1, 0xE0, 0x87, 0x00, 0x01, 0x03, 0xE0, 0x8A, 0x00, 0x01,
+    0x3F, 0x80, 0x84, 0x00, 0x01, 0x01, 0xC0, 0x82, 0x00, 0x02, 0x03, 0x83,
+    0x10, 0x88, 0x00, 0x00, 0xF8, 0x8A, 0x00, 0x00, 0x7E, 0x86, 0x00, 0x00,
+    0xE0, 0x82, 0x00, 0x02, 0x07, 0x80, 0x08, 0x88, 0x00, 0x00, 0x7C, 0x89,
+    0x00, 0x01, 0x01, 0xF0, 0x86, 0x00, 0x00, 0x70, 0x82, 0x00, 0x02, 0x0E,
+    0x04, 0x08, 0x88, 0x00, 0x00, 0x0F, 0x89, 0x00, 0x01, 0x07, 0xC0, 0x86,
+    0x00, 0x00, 0x30, 0x82, 0x00, 0x02, 0x0E, 0x04, 0x08, 0x88, 0x00, 0x01,
+    0x07, 0xC0, 0x88, 0x00, 0x00, 0x3F, 0x87, 0x00, 0x00, 0x18, 0x82, 0x00,
+    0x02, 0x1C, 0x04, 0x88, 0x89, 0x00, 0x00, 0xE0, 0x88, 0x00, 0x00, 0xFC,
+    0x87, 0x00, 0x00, 0x0C, 0x82, 0x00, 0x02, 0x38, 0x04, 0x08, 0x81, 0x00,
+    0x00, 0xE0, 0x85, 0x00, 0x00, 0x78, 0x87, 0x00, 0x01, 0x03, 0xF0, 0x87,
+    0x00, 0x00, 0x06, 0x82, 0x00, 0x01, 0x70, 0x04, 0x81, 0x00, 0x01, 0x03,
+    0x18, 0x85, 0x00, 0x00, 0x1C, 0x87, 0x00, 0x01, 0x07, 0xE0, 0x87, 0x00,
+    0x00, 0x03, 0x82, 0x00, 0x06, 0xE0, 0x04, 0x10, 0x00, 0x00, 0x06, 0x0C,
+    0x85, 0x00, 0x00, 0x0F, 0x87, 0x00, 0x01, 0x0F, 0x80, 0x87, 0x00, 0x00,
+    0x03, 0x82, 0x00, 0x06, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x08, 0x04, 0x85,
+    0x00, 0x01, 0x03, 0x80, 0x86, 0x00, 0x00, 0x1F, 0x88, 0x00, 0x0B, 0x01,
+    0x80, 0x00, 0x00, 0x01, 0xFF, 0xC3, 0xC0, 0x00, 0x00, 0x08, 0x06, 0x85,
+    0x00, 0x01, 0x01, 0xC0, 0x86, 0x00, 0x00, 0x38, 0x88, 0x00, 0x06, 0x01,
+    0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x81, 0x00, 0x01, 0x08, 0x02, 0x86,
+    0x00, 0x00, 0x70, 0x86, 0x00, 0x00, 0x30, 0x89, 0x00, 0x03, 0xC0, 0x00,
+    0xFF, 0xFF, 0x84, 0x00, 0x00, 0x82, 0x86, 0x00, 0x00, 0x38, 0x86, 0x00,
+    0x00, 0x60, 0x89, 0x00, 0x03, 0xE0, 0x07, 0xFF, 0xE0, 0x83, 0x00, 0x01,
+    0x08, 0x82, 0x86, 0x00, 0x00, 0x1C, 0x86, 0x00, 0x00, 0xC0, 0x89, 0x00,
+    0x03, 0x60, 0x0F, 0xFF, 0xE0, 0x83, 0x00, 0x01, 0x08, 0x04, 0x86, 0x00,
+    0x00, 0x06, 0x85, 0x00, 0x01, 0x01, 0x80, 0x89, 0x00, 0x03, 0x70, 0x1F,
+    0xFF, 0xF0, 0x83, 0x00, 0x01, 0x08, 0x04, 0x86, 0x00, 0x01, 0x03, 0x80,
+    0x84, 0x00, 0x00, 0x02, 0x8A, 0x00, 0x03, 0x30, 0x1F, 0xFF, 0xF0, 0x8D,
+    0x00, 0x01, 0x01, 0xC0, 0x84, 0x00, 0x00, 0x06, 0x8A, 0x00, 0x03, 0x30,
+    0x3F, 0xFF, 0xF0, 0x83, 0x00, 0x01, 0x03, 0xF0, 0x87, 0x00, 0x00, 0xE0,
+    0x84, 0x00, 0x00, 0x0C, 0x8A, 0x00, 0x03, 0x18, 0x3F, 0xFF, 0xF0, 0x84,
+    0x00, 0x00, 0xE0, 0x87, 0x00, 0x00, 0x70, 0x84, 0x00, 0x00, 0x18, 0x8A,
+    0x00, 0x03, 0x18, 0x3F, 0xFF, 0xF0, 0x8E, 0x00, 0x00, 0x38, 0x84, 0x00,
+    0x00, 0x30, 0x8A, 0x00, 0x03, 0x08, 0x3F, 0xFF, 0xE0, 0x8E, 0x00, 0x00,
+    0x1C, 0x84, 0x00, 0x00, 0x20, 0x8A, 0x00, 0x03, 0x08, 0x3F, 0xFF, 0xE0,
+    0x8E, 0x00, 0x00, 0x0C, 0x84, 0x00, 0x00, 0x40, 0x8A, 0x00, 0x03, 0x0C,
+    0x3F, 0xFF, 0xE0, 0x8E, 0x00, 0x00, 0x06, 0x84, 0x00, 0x00, 0xC0, 0x8A,
+    0x00, 0x03, 0x0C, 0x7F, 0xFF, 0xC0, 0x8E, 0x00, 0x00, 0x07, 0x84, 0x00,
+    0x00, 0x80, 0x8A, 0x00, 0x03, 0x0C, 0x7F, 0xFF, 0xC0, 0x8E, 0x00, 0x01,
+    0x03, 0x80, 0x82, 0x00, 0x00, 0x01, 0x8B, 0x00, 0x02, 0x0C, 0x7F, 0xFE,
+    0x8F, 0x00, 0x01, 0x01, 0xC0, 0x82, 0x00, 0x00, 0x01, 0x8B, 0x00, 0x02,
+    0x0E, 0x6F, 0xF8, 0x90, 0x00, 0x00, 0xC0, 0x82, 0x00, 0x00, 0x01, 0x8B,
+    0x00, 0x02, 0x0E, 0x67, 0xB8, 0x90, 0x00, 0x00, 0x60, 0x90, 0x00, 0x01,
+    0x06, 0x60, 0x91, 0x00, 0x00, 0x70, 0x82, 0x00, 0x00, 0x02, 0x8B, 0x00,
+    0x01, 0x06, 0x60, 0x91, 0x00, 0x00, 0x30, 0x82, 0x00, 0x00, 0x06, 0x8B,
+    0x00, 0x01, 0x06, 0x60, 0x91, 0x00, 0x00, 0x18, 0x82, 0x00, 0x00, 0x06,
+    0x8B, 0x00, 0x01, 0x06, 0x60, 0x91, 0x00, 0x00, 0x1C, 0x82, 0x00, 0x00,
+    0x06, 0x8B, 0x00, 0x01, 0x06, 0x60, 0x91, 0x00, 0x00, 0x0E, 0x82, 0x00,
+    0x00, 0x06, 0x8B, 0x00, 0x01, 0x06, 0x60, 0x91, 0x00, 0x00, 0x06, 0x82,
+    0x00, 0x00, 0x06, 0x8B, 0x00, 0x01, 0x06, 0x60, 0x91, 0x00, 0x00, 0x07,
+    0x82, 0x00, 0x00, 0x06, 0x8B, 0x00, 0x01, 0x06, 0x60, 0x91, 0x00, 0x01,
+    0x03, 0x80, 0x81, 0x00, 0x00, 0x06, 0x8B, 0x00, 0x01, 0x0E, 0x60, 0x91,
+    0x00, 0x01, 0x07, 0xF8, 0x81, 0x00, 0x00, 0x06, 0x8B, 0x00, 0x01, 0x0C,
+    0x60, 0x91, 0x00, 0x01, 0x0F, 0xF8, 0x81, 0x00, 0x00, 0x06, 0x8B, 0x00,
+    0x01, 0x0C, 0x30, 0x91, 0x00, 0x00, 0x18, 0x82, 0x00, 0x00, 0x06, 0x8B,
+    0x00, 0x01, 0x0C, 0x30, 0x91, 0x00, 0x00, 0x20, 0x82, 0x00, 0x00, 0x06,
+    0x8B, 0x00, 0x01, 0x0C, 0x38, 0x91, 0x00, 0x00, 0x60, 0x82, 0x00, 0x00,
+    0x06, 0x8B, 0x00, 0x04, 0x0C, 0x18, 0x00, 0xFF, 0xE0, 0x8E, 0x00, 0x00,
+    0xC0, 0x82, 0x00, 0x00, 0x06, 0x8B, 0x00, 0x04, 0x0C, 0x1C, 0x03, 0xFF,
+    0xFE, 0x8D, 0x00, 0x01, 0x01, 0x80, 0x82, 0x00, 0x00, 0x06, 0x8B, 0x00,
+    0x05, 0x0C, 0x0E, 0x07, 0x02, 0x07, 0xC0, 0x8C, 0x00, 0x00, 0x03, 0x83,
+    0x00, 0x00, 0x06, 0x8B, 0x00, 0x05, 0x0C, 0x06, 0x0E, 0x02, 0x03, 0xE0,
+    0x8C, 0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x06, 0x8B, 0x00, 0x05, 0x0C,
+    0x07, 0x0C, 0x02, 0x02, 0x7C, 0x8C, 0x00, 0x01, 0x07, 0x80, 0x82, 0x00,
+    0x00, 0x06, 0x8B, 0x00, 0x05, 0x0C, 0x03, 0x8C, 0x00, 0x06, 0x0F, 0x86,
+    0x00, 0x00, 0x06, 0x83, 0x00, 0x01, 0x03, 0xE0, 0x82, 0x00, 0x00, 0x06,
+    0x8B, 0x00, 0x06, 0x0C, 0x01, 0x8C, 0x00, 0x0C, 0x07, 0xC0, 0x85, 0x00,
+    0x00, 0x0F, 0x84, 0x00, 0x00, 0xF8, 0x82, 0x00, 0x00, 0x07, 0x8B, 0x00,
+    0x0A, 0x0C, 0x00, 0xCC, 0x00, 0x18, 0x04, 0x70, 0x00, 0x00, 0x3F, 0xFE,
+    0x81, 0x00, 0x01, 0x07, 0xC0, 0x83, 0x00, 0x05, 0x1F, 0xFF, 0x80, 0x00,
+    0x00, 0x03, 0x8B, 0x00, 0x0A, 0x06, 0x00, 0xEC, 0x00, 0x10, 0x04, 0x1C,
+    0x00, 0x03, 0xF0, 0x0E, 0x81, 0x00, 0x01, 0x86, 0x60, 0x83, 0x00, 0x05,
+    0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0x8B, 0x00, 0x0A, 0x06, 0x00, 0x7C,
+    0x00, 0xB0, 0x04, 0x0F, 0x00, 0x0F, 0xC0, 0x06, 0x81, 0x00, 0x01, 0xC2,
+    0x30, 0x84, 0x00, 0x04, 0x07, 0x80, 0x00, 0x00, 0x03, 0x8B, 0x00, 0x0A,
+    0x06, 0x00, 0x3C, 0x00, 0xE0, 0x04, 0x0F, 0xE0, 0x7F, 0x80, 0x06, 0x81,
+    0x00, 0x01, 0xE3, 0x18, 0x84, 0x00, 0x04, 0x03, 0x80, 0x00, 0x00, 0x01,
+    0x8B, 0x00, 0x0A, 0x02, 0x00, 0x1C, 0x00, 0xE0, 0x06, 0x0C, 0xFF, 0xF9,
+    0x00, 0x0C, 0x81, 0x00, 0x01, 0xF1, 0x8C, 0x84, 0x00, 0x00, 0x03, 0x81,
+    0x00, 0x01, 0x01, 0x80, 0x8A, 0x00, 0x0A, 0x03, 0x00, 0x0C, 0x00, 0x00,
+    0x02, 0x08, 0x1F, 0xC1, 0x00, 0x0C, 0x81, 0x00, 0x01, 0x7D, 0x87, 0x84,
+    0x00, 0x00, 0x07, 0x81, 0x00, 0x01, 0x01, 0x80, 0x8A, 0x00, 0x0A, 0x03,
+    0x00, 0x0E, 0x00, 0x00, 0x02, 0x08, 0x00, 0x81, 0x00, 0x08, 0x81, 0x00,
+    0x01, 0x6E, 0x83, 0x84, 0x00, 0x00, 0x0E, 0x82, 0x00, 0x00, 0xC0, 0x8A,
+    0x00, 0x0A, 0x01, 0x80, 0x0F, 0x00, 0x00, 0x03, 0x10, 0x00, 0x41, 0x00,
+    0x18, 0x81, 0x00, 0x02, 0x23, 0xC0, 0x80, 0x83, 0x00, 0x00, 0x0C, 0x82,
+    0x00, 0x00, 0xC0, 0x8A, 0x00, 0x0A, 0x01, 0x80, 0x0F, 0x80, 0x00, 0x03,
+    0x30, 0x00, 0x40, 0x00, 0x18, 0x81, 0x00, 0x02, 0x11, 0xC0, 0xC0, 0x83,
+    0x00, 0x00, 0x1C, 0x82, 0x00, 0x00, 0x60, 0x8B, 0x00, 0x09, 0xC0, 0x0C,
+    0xC0, 0x00, 0x03, 0x30, 0x00, 0x62, 0x00, 0x10, 0x81, 0x00, 0x02, 0x10,
+    0xC0, 0x60, 0x83, 0x00, 0x00, 0x18, 0x82, 0x00, 0x00, 0x20, 0x8B, 0x00,
+    0x09, 0xE0, 0x0C, 0xC0, 0x00, 0x03, 0x60, 0x00, 0x22, 0x00, 0x30, 0x81,
+    0x00, 0x02, 0x18, 0x40, 0xF0, 0x83, 0x00, 0x00, 0x38, 0x82, 0x00, 0x00,
+    0x10, 0x8B, 0x00, 0x09, 0x60, 0x0C, 0x60, 0x00, 0x01, 0xC0, 0x00, 0x14,
+    0x00, 0x20, 0x81, 0x00, 0x02, 0x08, 0x3F, 0xFE, 0x83, 0x00, 0x00, 0x38,
+    0x82, 0x00, 0x00, 0x08, 0x8B, 0x00, 0x0F, 0x38, 0x0C, 0x70, 0x00, 0x01,
+    0xC0, 0x00, 0x1C, 0x00, 0x20, 0x00, 0x00, 0x38, 0x0C, 0x7F, 0x7F, 0x83,
+    0x00, 0x00, 0x30, 0x82, 0x00, 0x00, 0x0C, 0x8B, 0x00, 0x10, 0x18, 0x08,
+    0x98, 0x00, 0x00, 0x80, 0x00, 0x18, 0x00, 0x60, 0x00, 0x00, 0x1C, 0x04,
+    0xE0, 0x07, 0x80, 0x82, 0x00, 0x00, 0x30, 0x82, 0x00, 0x00, 0x04, 0x8B,
+    0x00, 0x02, 0x0E, 0x09, 0x1C, 0x84, 0x00, 0x07, 0x60, 0x00, 0x00, 0x0E,
+    0x07, 0xC0, 0x03, 0xC0, 0x82, 0x00, 0x00, 0x60, 0x82, 0x00, 0x00, 0x03,
+    0x8B, 0x00, 0x02, 0x07, 0x0E, 0x1E, 0x84, 0x00, 0x07, 0xC0, 0x00, 0x00,
+    0x0F, 0x87, 0x00, 0x01, 0xE0, 0x82, 0x00, 0x00, 0x60, 0x82, 0x00, 0x01,
+    0x03, 0x80, 0x8A, 0x00, 0x02, 0x03, 0x8E, 0x13, 0x84, 0x00, 0x07, 0xC0,
+    0x00, 0x00, 0x07, 0xC6, 0x00, 0x00, 0xE0, 0x82, 0x00, 0x00, 0x60, 0x82,
+    0x00, 0x01, 0x01, 0xC0, 0x8A, 0x00, 0x02, 0x01, 0xEC, 0x13, 0x82, 0x00,
+    0x09, 0x60, 0x01, 0x80, 0x00, 0x00, 0x06, 0x6C, 0x00, 0x00, 0x78, 0x82,
+    0x00, 0x00, 0x60, 0x83, 0x00, 0x00, 0xE0, 0x89, 0x00, 0x04, 0x3F, 0xFF,
+    0xF8, 0x17, 0x80, 0x81, 0x00, 0x01, 0x70, 0x03, 0x81, 0x00, 0x04, 0x03,
+    0x3C, 0x00, 0x00, 0x38, 0x82, 0x00, 0x02, 0x60, 0x01, 0x80, 0x81, 0x00,
+    0x00, 0x78, 0x88, 0x00, 0x81, 0xFF, 0x02, 0xF8, 0x3C, 0xC0, 0x81, 0x00,
+    0x01, 0x7F, 0x03, 0x81, 0x00, 0x04, 0x01, 0x18, 0x00, 0x00, 0x1C, 0x82,
+    0x00, 0x01, 0x60, 0x03, 0x82, 0x00, 0x00, 0x3C, 0x87, 0x00, 0x06, 0x1F,
+    0xFF, 0xF8, 0x00, 0x20, 0x18, 0x60, 0x81, 0x00, 0x01, 0x47, 0xC6, 0x81,
+    0x00, 0x04, 0x01, 0x90, 0x00, 0x00, 0x1E, 0x82, 0x00, 0x01, 0x7C, 0x0E,
+    0x82, 0x00, 0x01, 0x1F, 0x80, 0x85, 0x00, 0x02, 0x1F, 0xFF, 0xC0, 0x82,
+    0x00, 0x00, 0x70, 0x81, 0x00, 0x01, 0x40, 0xFC, 0x82, 0x00, 0x03, 0xF0,
+    0x00, 0x00, 0x07, 0x82, 0x00, 0x01, 0x1F, 0xF8, 0x82, 0x00, 0x01, 0x07,
+    0xE0, 0x84, 0x00, 0x02, 0x03, 0xFF, 0x80, 0x83, 0x00, 0x00, 0x18, 0x81,
+    0x00, 0x01, 0x40, 0x38, 0x82, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x07, 0x80,
+    0x81, 0x00, 0x00, 0x07, 0x83, 0x00, 0x01, 0x01, 0xFC, 0x83, 0x00, 0x02,
+    0x03, 0xFF, 0xF0, 0x84, 0x00, 0x00, 0x1C, 0x81, 0x00, 0x01, 0x40, 0x30,
+    0x82, 0x00, 0x04, 0x70, 0x00, 0x00, 0x03, 0x80, 0x81, 0x00, 0x00, 0x06,
+    0x84, 0x00, 0x00, 0x3F, 0x83, 0x00, 0x01, 0xFF, 0xF0, 0x85, 0x00, 0x00,
+    0x0E, 0x81, 0x00, 0x01, 0x60, 0xF0, 0x82, 0x00, 0x04, 0x60, 0x00, 0x00,
+    0x01, 0xC0, 0x81, 0x00, 0x00, 0x18, 0x84, 0x00, 0x01, 0x0F, 0xF8, 0x81,
+    0x00, 0x01, 0x3F, 0xFE, 0x86, 0x00, 0x05, 0x07, 0x00, 0x10, 0x00, 0x60,
+    0xE0, 0x82, 0x00, 0x04, 0x60, 0x00, 0x00, 0x01, 0xC0, 0x81, 0x00, 0x00,
+    0x30, 0x84, 0x00, 0x05, 0x03, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x87, 0x00,
+    0x05, 0x03, 0x80, 0x1C, 0x00, 0x61, 0xC0, 0x82, 0x00, 0x00, 0x60, 0x81,
+    0x00, 0x00, 0xE0, 0x81, 0x00, 0x00, 0x20, 0x84, 0x00, 0x01, 0x03, 0xC7,
+    0x81, 0xFF, 0x00, 0xC0, 0x87, 0x00, 0x04, 0x11, 0xC0, 0x1E, 0x00, 0x23,
+    0x83, 0x00, 0x00, 0x60, 0x81, 0x00, 0x00, 0x60, 0x81, 0x00, 0x00, 0x40,
+    0x84, 0x00, 0x04, 0x0F, 0x00, 0x03, 0xFF, 0xE0, 0x88, 0x00, 0x04, 0x3F,
+    0xC0, 0x13, 0x80, 0x3E, 0x83, 0x00, 0x00, 0x60, 0x81, 0x00, 0x00, 0x70,
+    0x81, 0x00, 0x00, 0xC0, 0x84, 0x00, 0x00, 0x1C, 0x8C, 0x00, 0x04, 0x31,
+    0xE0, 0x10, 0xC0, 0x3C, 0x83, 0x00, 0x00, 0x60, 0x81, 0x00, 0x04, 0x30,
+    0x00, 0x00, 0x01, 0x80, 0x84, 0x00, 0x00, 0x38, 0x8C, 0x00, 0x04, 0x11,
+    0xC0, 0x10, 0x00, 0x38, 0x83, 0x00, 0x00, 0x60, 0x81, 0x00, 0x04, 0x38,
+    0x00, 0x00, 0x01, 0x80, 0x84, 0x00, 0x00, 0x70, 0x8C, 0x00, 0x04, 0x11,
+    0x80, 0x00, 0x30, 0x70, 0x83, 0x00, 0x00, 0x60, 0x81, 0x00, 0x03, 0x38,
+    0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0xE0, 0x8C, 0x00, 0x04, 0x0F, 0x80,
+    0x00, 0x18, 0xE0, 0x83, 0x00, 0x00, 0x60, 0x81, 0x00, 0x03, 0x1C, 0x00,
+    0x00, 0x03, 0x84, 0x00, 0x01, 0x01, 0xC0, 0x8B, 0x00, 0x05, 0x06, 0x0F,
+    0x00, 0x08, 0x0F, 0xC0, 0x83, 0x00, 0x00, 0x60, 0x81, 0x00, 0x03, 0x0C,
+    0x00, 0x00, 0x06, 0x84, 0x00, 0x01, 0x07, 0x80, 0x8B, 0x00, 0x04, 0x0F,
+    0x9E, 0x00, 0x08, 0x0F, 0x84, 0x00, 0x00, 0x60, 0x81, 0x00, 0x03, 0x0E,
+    0x00, 0x00, 0x06, 0x84, 0x00, 0x00, 0x07, 0x8C, 0x00, 0x04, 0x0C, 0x3C,
+    0x60, 0x08, 0x1E, 0x84, 0x00, 0x00, 0x60, 0x81, 0x00, 0x03, 0x0E, 0x00,
+    0x00, 0x0C, 0x84, 0x00, 0x00, 0x0E, 0x8C, 0x00, 0x04, 0x04, 0x38, 0x78,
+    0x08, 0x38, 0x84, 0x00, 0x00, 0x70, 0x81, 0x00, 0x03, 0x07, 0x00, 0x00,
+    0x0C, 0x84, 0x00, 0x00, 0x1C, 0x8C, 0x00, 0x04, 0x02, 0x30, 0x78, 0x08,
+    0x70, 0x84, 0x00, 0x00, 0x70, 0x81, 0x00, 0x03, 0x07, 0x00, 0x00, 0x0C,
+    0x84, 0x00, 0x00, 0x1C, 0x8C, 0x00, 0x04, 0x02, 0x60, 0x4C, 0x0D, 0xC0,
+    0x84, 0x00, 0x00, 0x70, 0x81, 0x00, 0x03, 0x03, 0x00, 0x00, 0x0C, 0x84,
+    0x00, 0x00, 0x38, 0x8C, 0x00, 0x04, 0x03, 0xC0, 0x46, 0x0F, 0x80, 0x84,
+    0x00, 0x00, 0x70, 0x81, 0x00, 0x03, 0x03, 0x80, 0x00, 0x0C, 0x84, 0x00,
+    0x00, 0x30, 0x8C, 0x00, 0x03, 0x81, 0x80, 0x43, 0x1E, 0x85, 0x00, 0x00,
+    0x30, 0x81, 0x00, 0x03, 0x01, 0x80, 0x00, 0x03, 0x84, 0x00, 0x02, 0x70,
+    0x00, 0x10, 0x8A, 0x00, 0x03, 0xC1, 0x80, 0x41, 0xFC, 0x85, 0x00, 0x00,
+    0x30, 0x81, 0x00, 0x04, 0x01, 0xC0, 0x00, 0x03, 0xC0, 0x83, 0x00, 0x02,
+    0x70, 0x00, 0x70, 0x8A, 0x00, 0x03, 0xF3, 0x80, 0x60, 0xC0, 0x85, 0x00,
+    0x00, 0x38, 0x82, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF8, 0x83, 0x00, 0x02,
+    0x7F, 0xFF, 0xF0, 0x8A, 0x00, 0x03, 0xD3, 0x80, 0x23, 0x80, 0x85, 0x00,
+    0x00, 0x38, 0x82, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7E, 0x83, 0x00, 0x02,
+    0x7F, 0xFF, 0xC0, 0x89, 0x00, 0x03, 0xC0, 0x43, 0xC0, 0x27, 0x86, 0x00,
+    0x00, 0x18, 0x82, 0x00, 0x04, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x83, 0x00,
+    0x01, 0x03, 0xC0, 0x89, 0x00, 0x03, 0xE0, 0x07, 0xFF, 0xFC, 0x86, 0x00,
+    0x00, 0x18, 0x82, 0x00, 0x04, 0x60, 0x00, 0x00, 0x3F, 0xF8, 0x83, 0x00,
+    0x01, 0x03, 0x80, 0x89, 0x00, 0x03, 0xF8, 0x07, 0x1F, 0xF0, 0x86, 0x00,
+    0x00, 0x1C, 0x82, 0x00, 0x03, 0x20, 0x00, 0x00, 0xF0, 0x84, 0x00, 0x00,
+    0x03, 0x8A, 0x00, 0x01, 0x7C, 0x27, 0x88, 0x00, 0x00, 0x1C, 0x82, 0x00,
+    0x03, 0x20, 0x00, 0x03, 0xE0, 0x84, 0x00, 0x00, 0x06, 0x8A, 0x00, 0x02,
+    0x26, 0x3F, 0x80, 0x87, 0x00, 0x00, 0x1C, 0x82, 0x00, 0x02, 0x10, 0x00,
+    0x0F, 0x85, 0x00, 0x00, 0x0E, 0x8A, 0x00, 0x02, 0x30, 0x39, 0x80, 0x87,
+    0x00, 0x00, 0x0C, 0x84, 0x00, 0x00, 0x3C, 0x85, 0x00, 0x00, 0x0C, 0x89,
+    0x00, 0x03, 0x02, 0x10, 0x70, 0xC0, 0x87, 0x00, 0x00, 0x0E, 0x84, 0x00,
+    0x00, 0x78, 0x85, 0x00, 0x02, 0x1C, 0x01, 0xC0, 0x87, 0x00, 0x03, 0x03,
+    0x98, 0x60, 0xE0, 0x87, 0x00, 0x00, 0x0E, 0x84, 0x00, 0x00, 0xE0, 0x85,
+    0x00, 0x03, 0x18, 0x03, 0xC0, 0x10, 0x86, 0x00, 0x03, 0x01, 0xFC, 0xC0,
+    0x78, 0x87, 0x00, 0x00, 0x0E, 0x84, 0x00, 0x00, 0xF0, 0x85, 0x00, 0x03,
+    0x18, 0x0F, 0xC0, 0x30, 0x86, 0x00, 0x03, 0x01, 0x3D, 0xC0, 0x3C, 0x87,
+    0x00, 0x00, 0x0E, 0x84, 0x00, 0x00, 0x78, 0x85, 0x00, 0x03, 0x18, 0x3C,
+    0xC0, 0x60, 0x87, 0x00, 0x03, 0x8F, 0x80, 0x1F, 0xC0, 0x86, 0x00, 0x00,
+    0x07, 0x84, 0x00, 0x00, 0x1F, 0x85, 0x00, 0x03, 0x7F, 0xF0, 0xC0, 0xE0,
+    0x87, 0x00, 0x03, 0x43, 0x80, 0x03, 0xFF, 0x86, 0x00, 0x00, 0x07, 0x84,
+    0x00, 0x01, 0x03, 0xC0, 0x82, 0x00, 0x05, 0x01, 0xFF, 0xFF, 0xE0, 0xE1,
+    0xC0, 0x87, 0x00, 0x04, 0x63, 0x80, 0x00, 0xFF, 0xF8, 0x85, 0x00, 0x01,
+    0x07, 0x80, 0x83, 0x00, 0x01, 0x01, 0xF0, 0x82, 0x00, 0x05, 0x03, 0xFF,
+    0xE0, 0x00, 0x63, 0x80, 0x87, 0x00, 0x05, 0x23, 0x80, 0x00, 0x1F, 0xFF,
+    0xF8, 0x84, 0x00, 0x01, 0x03, 0x80, 0x84, 0x00, 0x00, 0x7E, 0x82, 0x00,
+    0x05, 0x03, 0xFF, 0x00, 0x00, 0x67, 0x80, 0x87, 0x00, 0x06, 0x13, 0x80,
+    0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x83, 0x00, 0x01, 0x03, 0x80, 0x84, 0x00,
+    0x01, 0x1F, 0xF0, 0x81, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00, 0x7F, 0x88,
+    0x00, 0x00, 0x13, 0x81, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0x80, 0x82, 0x00,
+    0x01, 0x03, 0x80, 0x84, 0x00, 0x01, 0x3F, 0xC0, 0x81, 0x00, 0x00, 0x03,
+    0x81, 0x00, 0x00, 0x7E, 0x88, 0x00, 0x00, 0x0B, 0x81, 0x00, 0x03, 0x0F,
+    0x07, 0xFF, 0xC0, 0x82, 0x00, 0x01, 0x03, 0x80, 0x84, 0x00, 0x00, 0xF0,
+    0x82, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00, 0x38, 0x88, 0x00, 0x00, 0x07,
+    0x81, 0x00, 0x01, 0x07, 0x83, 0x84, 0x00, 0x01, 0x01, 0xC0, 0x83, 0x00,
+    0x00, 0x07, 0x83, 0x00, 0x00, 0x03, 0x8C, 0x00, 0x05, 0x03, 0x80, 0x00,
+    0x00, 0x03, 0x83, 0x84, 0x00, 0x01, 0x01, 0xC0, 0x83, 0x00, 0x00, 0x0E,
+    0x83, 0x00, 0x01, 0x01, 0x80, 0x8B, 0x00, 0x05, 0x03, 0x80, 0x00, 0x00,
+    0x03, 0xC3, 0x84, 0x00, 0x01, 0x01, 0xC0, 0x83, 0x00, 0x00, 0x1C, 0x83,
+    0x00, 0x01, 0x01, 0x80, 0x8B, 0x00, 0x05, 0x03, 0x80, 0x00, 0x00, 0x01,
+    0xE1, 0x84, 0x00, 0x01, 0x01, 0xC0, 0x83, 0x00, 0x00, 0x1F, 0x83, 0x00,
+    0x01, 0x01, 0xC0, 0x8B, 0x00, 0x01, 0x03, 0x80, 0x81, 0x00, 0x00, 0xE1,
+    0x85, 0x00, 0x00, 0xC0, 0x83, 0x00, 0x01, 0x1F, 0xE0, 0x83, 0x00, 0x00,
+    0xC0, 0x8B, 0x00, 0x01, 0x01, 0x80, 0x81, 0x00, 0x00, 0x71, 0x85, 0x00,
+    0x00, 0xC0, 0x84, 0x00, 0x01, 0x7F, 0x80, 0x82, 0x00, 0x00, 0xE0, 0x8B,
+    0x00, 0x01, 0x01, 0xC0, 0x81, 0x00, 0x00, 0x39, 0x85, 0x00, 0x00, 0xE0,
+    0x84, 0x00, 0x01, 0x3F, 0xC0, 0x82, 0x00, 0x00, 0x60, 0x8B, 0x00, 0x01,
+    0x01, 0xC0, 0x81, 0x00, 0x01, 0x39, 0x80, 0x84, 0x00, 0x00, 0x60, 0x84,
+    0x00, 0x00, 0x3E, 0x83, 0x00, 0x00, 0x70, 0x8C, 0x00, 0x00, 0xC0, 0x81,
+    0x00, 0x01, 0x1F, 0x80, 0x84, 0x00, 0x00, 0x60, 0x84, 0x00, 0x00, 0xF0,
+    0x83, 0x00, 0x00, 0x30, 0x8C, 0x00, 0x00, 0xC0, 0x81, 0x00, 0x01, 0x1F,
+    0x80, 0x84, 0x00, 0x00, 0x60, 0x83, 0x00, 0x01, 0x03, 0xC0, 0x83, 0x00,
+    0x00, 0x38, 0x8C, 0x00, 0x00, 0xC0, 0x81, 0x00, 0x01, 0x0F, 0x80, 0x84,
+    0x00, 0x00, 0x70, 0x83, 0x00, 0x00, 0x06, 0x84, 0x00, 0x00, 0x38, 0x8C,
+    0x00, 0x00, 0x60, 0x81, 0x00, 0x01, 0x07, 0x80, 0x84, 0x00, 0x00, 0x70,
+    0x83, 0x00, 0x02, 0x08, 0x00, 0x0E, 0x81, 0x00, 0x01, 0x07, 0xFC, 0x83,
+    0x00, 0x01, 0x03, 0xF0, 0x85, 0x00, 0x00, 0x60, 0x81, 0x00, 0x01, 0x03,
+    0x80, 0x84, 0x00, 0x00, 0x70, 0x83, 0x00, 0x02, 0x30, 0x00, 0x1C, 0x81,
+    0x00, 0x01, 0x1F, 0xF8, 0x81, 0x00, 0x03, 0x01, 0x00, 0x00, 0xF8, 0x85,
+    0x00, 0x00, 0x70, 0x81, 0x00, 0x01, 0x03, 0x80, 0x84, 0x00, 0x00, 0x30,
+    0x83, 0x00, 0x02, 0x60, 0x00, 0x1C, 0x81, 0x00, 0x00, 0x7C, 0x82, 0x00,
+    0x03, 0x0F, 0x00, 0x00, 0x1C, 0x85, 0x00, 0x00, 0x30, 0x81, 0x00, 0x01,
+    0x01, 0x80, 0x84, 0x00, 0x00, 0x38, 0x82, 0x00, 0x03, 0x01, 0xC0, 0x00,
+    0x38, 0x81, 0x00, 0x00, 0xF0, 0x82, 0x00, 0x03, 0x1F, 0x00, 0x00, 0x0E,
+    0x85, 0x00, 0x00, 0x30, 0x81, 0x00, 0x01, 0x01, 0x80, 0x84, 0x00, 0x00,
+    0x38, 0x82, 0x00, 0x07, 0x03, 0x80, 0x00, 0x78, 0x00, 0x00, 0x01, 0xE0,
+    0x81, 0x00, 0x04, 0x3F, 0xFE, 0x00, 0x00, 0x06, 0x85, 0x00, 0x00, 0x38,
+    0x81, 0x00, 0x01, 0x01, 0x80, 0x84, 0x00, 0x00, 0x38, 0x82, 0x00, 0x03,
+    0x03, 0x80, 0x00, 0xF0, 0x81, 0x00, 0x00, 0xFC, 0x81, 0x00, 0x04, 0x1F,
+    0xFE, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0x18, 0x81, 0x00, 0x01, 0x01,
+    0x80, 0x84, 0x00, 0x00, 0x1C, 0x82, 0x00, 0x03, 0x03, 0x80, 0x00, 0xE0,
+    0x81, 0x00, 0x00, 0x7F, 0x82, 0x00, 0x03, 0x1C, 0x0C, 0x00, 0x03, 0x85,
+    0x00, 0x00, 0x0C, 0x81, 0x00, 0x01, 0x01, 0x80, 0x84, 0x00, 0x00, 0x1C,
+    0x82, 0x00, 0x03, 0x01, 0xC0, 0x03, 0xE0, 0x81, 0x00, 0x01, 0x1F, 0xE0,
+    0x81, 0x00, 0x04, 0x1C, 0x1E, 0x00, 0x03, 0x80, 0x84, 0x00, 0x00, 0x0C,
+    0x81, 0x00, 0x01, 0x01, 0x80, 0x84, 0x00, 0x00, 0x1C, 0x83, 0x00, 0x02,
+    0xF0, 0x0F, 0xC0, 0x81, 0x00, 0x01, 0x03, 0xF8, 0x81, 0x00, 0x04, 0x18,
+    0x7C, 0x1E, 0x01, 0x80, 0x84, 0x00, 0x00, 0x0E, 0x81, 0x00, 0x01, 0x01,
+    0x80, 0x84, 0x00, 0x00, 0x0C, 0x83, 0x00, 0x02, 0x1F, 0xFF, 0x80, 0x81,
+    0x00, 0x01, 0x07, 0xF8, 0x81, 0x00, 0x04, 0x19, 0xFC, 0x3F, 0x81, 0x80,
+    0x84, 0x00, 0x00, 0x06, 0x81, 0x00, 0x01, 0x01, 0x80, 0x84, 0x00, 0x00,
+    0x0E, 0x84, 0x00, 0x01, 0x03, 0x80, 0x81, 0x00, 0x01, 0x1F, 0xF0, 0x81,
+    0x00, 0x04, 0x3F, 0xFC, 0x3B, 0xC1, 0x80, 0x84, 0x00, 0x00, 0x07, 0x81,
+    0x00, 0x01, 0x01, 0x80, 0x84, 0x00, 0x00, 0x0E, 0x84, 0x00, 0x01, 0x03,
+    0x06, 0x81, 0x00, 0x00, 0x3E, 0x82, 0x00, 0x04, 0x3F, 0xDC, 0x30, 0xF1,
+    0x80, 0x84, 0x00, 0x00, 0x03, 0x81, 0x00, 0x01, 0x01, 0x80, 0x84, 0x00,
+    0x00, 0x06, 0x84, 0x00, 0x01, 0x03, 0x1E, 0x81, 0x00, 0x00, 0x78, 0x82,
+    0x00, 0x80, 0x1C, 0x02, 0x70, 0x7D, 0x80, 0x84, 0x00, 0x00, 0x03, 0x81,
+    0x00, 0x01, 0x01, 0x80, 0x84, 0x00, 0x00, 0x07, 0x84, 0x00, 0x01, 0x07,
+    0xFE, 0x81, 0x00, 0x00, 0xF0, 0x83, 0x00, 0x03, 0x1C, 0x60, 0x1F, 0x80,
+    0x84, 0x00, 0x05, 0x03, 0x80, 0x00, 0x00, 0x01, 0x80, 0x84, 0x00, 0x00,
+    0x07, 0x84, 0x00, 0x05, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xC0, 0x83, 0x00,
+    0x03, 0x1C, 0xE0, 0x0F, 0x80, 0x84, 0x00, 0x05, 0x01, 0x80, 0x00, 0x00,
+    0x01, 0x80, 0x84, 0x00, 0x00, 0x07, 0x81, 0x00, 0x07, 0x0F, 0xFE, 0x00,
+    0x0F, 0x86, 0x00, 0x00, 0x07, 0x84, 0x00, 0x03, 0x1C, 0xE0, 0x03, 0x80,
+    0x85, 0x00, 0x04, 0xC0, 0x00, 0x00, 0x01, 0x80, 0x84, 0x00, 0x00, 0x03,
+    0x81, 0x00, 0x07, 0x7F, 0x1F, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x84,
+    0x00, 0x01, 0x1C, 0xC0, 0x87, 0x00, 0x04, 0xC0, 0x00, 0x00, 0x01, 0x80,
+    0x84, 0x00, 0x0B, 0x03, 0x00, 0x00, 0x01, 0xF0, 0x01, 0xE0, 0x00, 0x0C,
+    0x00, 0x00, 0x0C, 0x84, 0x00, 0x01, 0x1D, 0x80, 0x87, 0x00, 0x04, 0xE0,
+    0x00, 0x00, 0x01, 0x80, 0x84, 0x00, 0x0B, 0x03, 0x80, 0x00, 0x07, 0x80,
+    0x00, 0x70, 0x7C, 0x1C, 0x00, 0x00, 0x18, 0x84, 0x00, 0x02, 0x1F, 0x80,
+    0x18, 0x86, 0x00, 0x04, 0x60, 0x00, 0x00, 0x01, 0x80, 0x84, 0x00, 0x0B,
+    0x01, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x7F, 0x18, 0x00, 0x00, 0x30,
+    0x84, 0x00, 0x02, 0x1F, 0x00, 0x18, 0x86, 0x00, 0x04, 0x70, 0x00, 0x00,
+    0x01, 0x80, 0x84, 0x00, 0x0B, 0x01, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x1C,
+    0x67, 0xF8, 0x00, 0x00, 0x60, 0x84, 0x00, 0x02, 0x1F, 0x00, 0x38, 0x86,
+    0x00, 0x04, 0x78, 0x00, 0x00, 0x01, 0x80, 0x85, 0x00, 0x0A, 0xC0, 0x00,
+    0x07, 0x00, 0x00, 0x0E, 0x60, 0xF8, 0x00, 0x00, 0xC0, 0x84, 0x00, 0x02,
+    0x1C, 0x00, 0x38, 0x86, 0x00, 0x04, 0x38, 0x00, 0x00, 0x01, 0x80, 0x85,
+    0x00, 0x0A, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x03, 0x60, 0x10, 0x00, 0x00,
+    0xC0, 0x86, 0x00, 0x00, 0x38, 0x86, 0x00, 0x04, 0x1C, 0x00, 0x00, 0x01,
+    0x80, 0x85, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xE0, 0x00,
+    0x00, 0x01, 0xC0, 0x03, 0x85, 0x00, 0x00, 0x30, 0x86, 0x00, 0x03, 0x1C,
+    0x00, 0x00, 0x01, 0x86, 0x00, 0x0B, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x01, 0x80, 0x07, 0x83, 0x00, 0x02, 0x01, 0x00, 0x30,
+    0x86, 0x00, 0x03, 0x1E, 0x00, 0x00, 0x01, 0x86, 0x00, 0x0B, 0x60, 0x00,
+    0x00, 0x60, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x01, 0xC0, 0x1E, 0x83, 0x00,
+    0x02, 0x03, 0x00, 0x70, 0x86, 0x00, 0x03, 0x0E, 0x00, 0x00, 0x01, 0x86,
+    0x00, 0x03, 0x30, 0x01, 0xFE, 0x30, 0x83, 0x00, 0x02, 0x01, 0xFF, 0xFC,
+    0x83, 0x00, 0x02, 0x07, 0x00, 0x60, 0x86, 0x00, 0x00, 0x0E, 0x89, 0x00,
+    0x03, 0x10, 0x0F, 0xFF, 0xDC, 0x84, 0x00, 0x01, 0x1F, 0xF8, 0x83, 0x00,
+    0x02, 0x07, 0x00, 0xE0, 0x86, 0x00, 0x00, 0x07, 0x89, 0x00, 0x03, 0x18,
+    0x3C, 0x00, 0xFE, 0x85, 0x00, 0x00, 0xF0, 0x83, 0x00, 0x02, 0x06, 0x01,
+    0xC0, 0x86, 0x00, 0x00, 0x03, 0x89, 0x00, 0x03, 0x08, 0xF0, 0x00, 0x1E,
+    0x85, 0x00, 0x00, 0xE0, 0x83, 0x00, 0x02, 0x06, 0x01, 0xC0, 0x86, 0x00,
+    0x01, 0x03, 0x80, 0x88, 0x00, 0x01, 0x05, 0xE0, 0x86, 0x00, 0x01, 0x01,
+    0xC0, 0x83, 0x00, 0x02, 0x06, 0x03, 0x80, 0x86, 0x00, 0x01, 0x01, 0x80,
+    0x88, 0x00, 0x01, 0x07, 0x80, 0x86, 0x00, 0x01, 0x03, 0x80, 0x83, 0x00,
+    0x01, 0x06, 0x03, 0x87, 0x00, 0x01, 0x01, 0xC0, 0x88, 0x00, 0x00, 0x07,
+    0x87, 0x00, 0x00, 0x07, 0x84, 0x00, 0x01, 0x06, 0x07, 0x88, 0x00, 0x00,
+    0xC0, 0x88, 0x00, 0x00, 0x07, 0x87, 0x00, 0x00, 0x0E, 0x84, 0x00, 0x01,
+    0x06, 0x0E, 0x88, 0x00, 0x00, 0x60, 0x88, 0x00, 0x01, 0x03, 0xE0, 0x86,
+    0x00, 0x00, 0x1C, 0x84, 0x00, 0x01, 0x06, 0x1E, 0x88, 0x00, 0x00, 0x60,
+    0x89, 0x00, 0x00, 0xF8, 0x86, 0x00, 0x00, 0x38, 0x84, 0x00, 0x01, 0x07,
+    0x78, 0x88, 0x00, 0x00, 0x30, 0x89, 0x00, 0x01, 0x0F, 0xC0, 0x85, 0x00,
+    0x00, 0x30, 0x84, 0x00, 0x04, 0x07, 0xF8, 0x00, 0x00, 0x40, 0x85, 0x00,
+    0x00, 0x38, 0x89, 0x00, 0x02, 0x01, 0xFF, 0x80, 0x84, 0x00, 0x00, 0x60,
+    0x84, 0x00, 0x04, 0x07, 0xE0, 0x00, 0x03, 0xC0, 0x85, 0x00, 0x00, 0x18,
+    0x8A, 0x00, 0x01, 0x7F, 0xC0, 0x84, 0x00, 0x00, 0x60, 0x84, 0x00, 0x04,
+    0x03, 0xC0, 0x00, 0x07, 0x80, 0x85, 0x00, 0x00, 0x18, 0x89, 0x00, 0x02,
+    0x02, 0xFF, 0x80, 0x84, 0x00, 0x00, 0x40, 0x87, 0x00, 0x00, 0x1E, 0x86,
+    0x00, 0x00, 0x1C, 0x89, 0x00, 0x01, 0x3F, 0xE0, 0x85, 0x00, 0x00, 0xC0,
+    0x87, 0x00, 0x00, 0x38, 0x86, 0x00, 0x00, 0x0C, 0x89, 0x00, 0x00, 0xFE,
+    0x86, 0x00, 0x00, 0xC0, 0x87, 0x00, 0x00, 0xF0, 0x86, 0x00, 0x00, 0x06,
+    0x88, 0x00, 0x01, 0x03, 0xE0, 0x86, 0x00, 0x02, 0xC0, 0x00, 0xC0, 0x84,
+    0x00, 0x01, 0x01, 0xC0, 0x86, 0x00, 0x02, 0x07, 0x00, 0x02, 0x86, 0x00,
+    0x00, 0x07, 0x86, 0x00, 0x03, 0x01, 0x80, 0x03, 0xC0, 0x84, 0x00, 0x01,
+    0x03, 0x80, 0x86, 0x00, 0x02, 0x03, 0x00, 0x02, 0x86, 0x00, 0x00, 0x0C,
+    0x86, 0x00, 0x03, 0x01, 0x80, 0x03, 0x80, 0x84, 0x00, 0x00, 0x07, 0x87,
+    0x00, 0x02, 0x03, 0x00, 0x06, 0x86, 0x00, 0x00, 0x18, 0x86, 0x00, 0x02,
+    0x01, 0x80, 0x07, 0x85, 0x00, 0x00, 0x0E, 0x87, 0x00, 0x02, 0x03, 0x80,
+    0x06, 0x86, 0x00, 0x00, 0x18, 0x86, 0x00, 0x02, 0x01, 0x80, 0x0E, 0x85,
+    0x00, 0x02, 0x1C, 0x00, 0xC0, 0x85, 0x00, 0x02, 0x01, 0x80, 0x06, 0x86,
+    0x00, 0x00, 0x30, 0x86, 0x00, 0x02, 0x01, 0x80, 0x3C, 0x85, 0x00, 0x02,
+    0x3C, 0x07, 0xC0, 0x86, 0x00, 0x01, 0xC0, 0x06, 0x86, 0x00, 0x00, 0x20,
+    0x86, 0x00, 0x02, 0x01, 0xDF, 0xFC, 0x85, 0x00, 0x02, 0x7F, 0xFF, 0xC0,
+    0x86, 0x00, 0x01, 0xE0, 0x06, 0x86, 0x00, 0x00, 0x60, 0x86, 0x00,
+};
+const size_t picture_rle_size = sizeof(picture_rle);
@@ -0,0 +1,131 @@
+/**
+ * @ingroup     tests
+ *
+ * @{
+ * @file
+ * @brief       Check the RA8835 layer composition modes on the simulator
+ *
+ * Draws different content on each layer, then for every ra8835_mix_t
+ * renders what the panel shows and compares it with the layers rendered
+ * one by one and combined the way the mode says. Runs in both
+ * orientations, with text over graphics and with three graphics layers.
+ *
+ * @author      Alexander Podshivalov <a_podshivalov@mail.ru>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ra8835.h"
+#include "ra8835_sim.h"
+
+#define COLS        (320U)
+#define ROWS        (240U)
+#define SIZE        (COLS * ROWS / 8)
+
+static ra8835_t dev = {
+    .cols = COLS,
+    .rows = ROWS,
+    .wr = GPIO_PIN(0, 0),
+    .rd = GPIO_PIN(0, 1),
+    .cs = GPIO_PIN(0, 2),
+    .a0 = GPIO_PIN(0, 3),
+    .rst = GPIO_PIN(0, 4),
+    .data = {
+        GPIO_PIN(1, 0), GPIO_PIN(1, 1), GPIO_PIN(1, 2), GPIO_PIN(1, 3),
+        GPIO_PIN(1, 4), GPIO_PIN(1, 5), GPIO_PIN(1, 6), GPIO_PIN(1, 7),
+    },
+};
+
+static const char *mix_name[] = { "OR", "XOR", "AND", "POR" };
+
+static uint8_t l1[SIZE], l2[SIZE], l3[SIZE], shown[SIZE];
+
+/* Overlapping shapes so that every mode gives a different picture */
+static void _draw(void){
+    if( dev.layers == 3 ){
+        ra8835_draw_layer(&dev, 1);
+        ra8835_fill_rect(&dev, 10, 10, 200, 120, RA8835_PIXEL_SET);
+        ra8835_draw_layer(&dev, 3);
+        ra8835_fill_rect(&dev, 250, 180, 60, 50, RA8835_PIXEL_SET);
+        ra8835_line(&dev, 0, 239, 319, 0);
+        ra8835_draw_layer(&dev, 2);
+    } else {
+        for(uint8_t row = 2; row < 12; row++){
+            ra8835_text_set_cursor(&dev, 1, row);
+            ra8835_text_print(&dev, "Layer composition test");
+        }
+    }
+    ra8835_fill_rect(&dev, 100, 60, 180, 100, RA8835_PIXEL_SET);
+    ra8835_rect(&dev, 4, 4, 312, 232, RA8835_PIXEL_SET);
+    ra8835_line(&dev, 0, 0, 319, 239);
+}
+
+static int _check(const char *mode){
+    int failed = 0;
+    
+    ra8835_sim_render(RA8835_SIM_LAYER1, l1, SIZE);
+    ra8835_sim_render(RA8835_SIM_LAYER2, l2, SIZE);
+    if( dev.layers == 3 ){
+        ra8835_sim_render(RA8835_SIM_LAYER3, l3, SIZE);
+    } else {
+        memset(l3, 0, SIZE);
+    }
+    
+    for(unsigned mix = RA8835_MIX_OR; mix <= RA8835_MIX_POR; mix++){
+        int ok = 1;
+        
+        ra8835_set_mix(&dev, mix);
+        ra8835_sim_render(RA8835_SIM_COMPOSITE, shown, SIZE);
+        for(unsigned i = 0; i < SIZE; i++){
+            uint8_t want;
+            
+            switch( mix ){
+                case RA8835_MIX_XOR: want = l1[i] ^ l2[i]; break;
+                case RA8835_MIX_AND: want = l1[i] & l2[i]; break;
+                default:             want = l1[i] | l2[i]; break;
+            }
+            if( shown[i] != (want | l3[i]) ){
+                ok = 0;
+                break;
+            }
+        }
+        printf("%s, %s: %s\n", mode, mix_name[mix], ok ? "ok" : "wrong picture");
+        failed |= !ok;
+    }
+    return failed;
+}
+
+int main(void){
+    int failed = 0;
+    ra8835_sim_stats_t stats;
+    
+    for(unsigned layers = 2; layers <= 3; layers++){
+        for(unsigned ud = 0; ud <= 1; ud++){
+            char mode[48];
+            
+            dev.layers = layers;
+            dev.upside_down = ud;
+            memset(&dev.map, 0, sizeof(dev.map));
+            if( ra8835_init(&dev) < 0 ){
+                puts("init failed");
+                return 1;
+            }
+            _draw();
+            snprintf(mode, sizeof(mode), "%s, %s",
+                     layers == 3 ? "three layers" : "text over graphics",
+                     ud ? "upside down" : "upright");
+            failed |= _check(mode);
+        }
+    }
+    
+    ra8835_sim_get_stats(&stats);
+    if( stats.timing_violations ){
+        printf("%u timing violations\n", (unsigned)stats.timing_violations);
+        failed = 1;
+    }
+    puts(failed ? "FAILURE" : "SUCCESS");
+    return failed;
+}
@@ -0,0 +1,251 @@
+#!/usr/bin/env python3
+"""Convert a picture to a C array for the RA8835 driver.
+
+The output has the layout ra8835_write_img() expects: rows packed one after
+another, MSB is the leftmost pixel and a set bit is a dark pixel. With
+--flip the array is turned around for upside-down displays, bytes in
+reverse order and bits in each byte mirrored, and is meant for
+ra8835_write_img_native(). With --rle it is run-length coded for
+ra8835_write_img_rle(), and NAME_size holds its length.
+
+Reads binary (P4) and plain (P1) PBM files and non-interlaced PNG files.
+PNG pixels darker than half brightness, and not transparent, are set.
+
+    tools/ra8835_img.py --flip --rle --name picture picture.png picture.c
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+# Same as RA8835_RLE_REPEAT in ra8835.h
+RLE_REPEAT = 0x80
+RLE_MAX = 128
+
+
+def _pbm_tokens(data):
+    """Split a PBM header into tokens, return them and the rest of data."""
+    tokens = []
+    pos = 0
+    while len(tokens) < 3:
+        while pos < len(data) and data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b'#':
+            while pos < len(data) and data[pos:pos + 1] not in (b'\n', b'\r'):
+                pos += 1
+            continue
+        start = pos
+        while pos < len(data) and not data[pos:pos + 1].isspace():
+            pos += 1
+        if start == pos:
+            raise ValueError('truncated PBM header')
+        tokens.append(data[start:pos])
+    # Exactly one whitespace byte separates the header from P4 pixel data
+    return tokens, data[pos + 1:]
+
+
+def read_pbm(data):
+    """Return (width, height, packed rows) of a PBM file."""
+    (magic, width, height), body = _pbm_tokens(data)
+    width, height = int(width), int(height)
+    stride = (width + 7) // 8
+    if magic == b'P4':
+        if len(body) < stride * height:
+            raise ValueError('truncated PBM data')
+        return width, height, bytes(body[:stride * height])
+    if magic == b'P1':
+        bits = [b - ord('0') for b in body if b in b'01']
+        if len(bits) < width * height:
+            raise ValueError('truncated PBM data')
+        out = bytearray(stride * height)
+        for y in range(height):
+            for x in range(width):
+                if bits[y * width + x]:
+                    out[y * stride + x // 8] |= 0x80 >> (x % 8)
+        return width, height, bytes(out)
+    raise ValueError('not a PBM file')
+
+
+def _unfilter(raw, height, stride, bpp):
+    """Undo the PNG scanline filters, return the list of rows."""
+    rows = []
+    prev = bytearray(stride)
+    pos = 0
+    for _ in range(height):
+        ftype = raw[pos]
+        line = bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else b if pb <= pc else c
+                line[i] = (line[i] + pred) & 0xFF
+            elif ftype != 0:
+                raise ValueError('bad PNG filter type {}'.format(ftype))
+        rows.append(line)
+        prev = line
+    return rows
+
+
+def read_png(data):
+    """Return (width, height, packed rows) of a PNG file."""
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('not a PNG file')
+    pos = 8
+    idat = b''
+    palette = None
+    trns = None
+    while pos < len(data):
+        length, ctype = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b'IHDR':
+            width, height, depth, color, _, _, interlace = \
+                struct.unpack('>IIBBBBB', chunk)
+        elif ctype == b'PLTE':
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, length, 3)]
+        elif ctype == b'tRNS':
+            trns = chunk
+        elif ctype == b'IDAT':
+            idat += chunk
+        elif ctype == b'IEND':
+            break
+    if interlace:
+        raise ValueError('interlaced PNG files are not supported')
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    bits = depth * channels
+    stride = (width * bits + 7) // 8
+    rows = _unfilter(zlib.decompress(idat), height, stride,
+                     max(1, bits // 8))
+    maxval = (1 << depth) - 1
+
+    def sample(row, i):
+        if depth == 16:
+            return (row[2 * i] << 8 | row[2 * i + 1]) / maxval
+        if depth == 8:
+            return row[i] / maxval
+        shift = 8 - depth - (i * depth) % 8
+        return ((row[i * depth // 8] >> shift) & maxval) / maxval
+
+    out_stride = (width + 7) // 8
+    out = bytearray(out_stride * height)
+    for y, row in enumerate(rows):
+        for x in range(width):
+            v = [sample(row, x * channels + k) for k in range(channels)]
+            alpha = 1.0
+            if color == 3:
+                idx = int(round(v[0] * maxval))
+                if trns is not None and idx < len(trns):
+                    alpha = trns[idx] / 255
+                v = [c / 255 for c in palette[idx]]
+            elif color in (4, 6):
+                alpha = v.pop()
+            luma = sum(v) / len(v)
+            if alpha >= 0.5 and luma < 0.5:
+                out[y * out_stride + x // 8] |= 0x80 >> (x % 8)
+    return width, height, bytes(out)
+
+
+def read_image(data):
+    """Return (width, height, packed rows) of a PBM or PNG file."""
+    if data[:8] == b'\x89PNG\r\n\x1a\n':
+        return read_png(data)
+    return read_pbm(data)
+
+
+def flip(img):
+    """Turn a packed image around for an upside-down display."""
+    return bytes(int('{:08b}'.format(b)[::-1], 2) for b in reversed(img))
+
+
+def rle(img):
+    """Run-length code a packed image, see RA8835_RLE_REPEAT."""
+    out = bytearray()
+    lit = bytearray()
+
+    def flush_literal():
+        for i in range(0, len(lit), RLE_MAX):
+            part = lit[i:i + RLE_MAX]
+            out.append(len(part) - 1)
+            out.extend(part)
+        del lit[:]
+
+    pos = 0
+    while pos < len(img):
+        run = 1
+        while pos + run < len(img) and run < RLE_MAX + 1 and \
+                img[pos + run] == img[pos]:
+            run += 1
+        # A run of two only pays off between two other runs
+        if run >= 3 or (run == 2 and not lit):
+            flush_literal()
+            out.append(RLE_REPEAT | (run - 2))
+            out.append(img[pos])
+        else:
+            lit.extend(img[pos:pos + run])
+        pos += run
+    flush_literal()
+    return bytes(out)
+
+
+def to_c(name, img, source, coded):
+    lines = ['/* Generated by tools/ra8835_img.py from {}, do not edit */'
+             .format(source),
+             '#include <stddef.h>' if coded else None,
+             '#include <stdint.h>',
+             '',
+             'const uint8_t {}[{}] = {{'.format(name, len(img))]
+    for i in range(0, len(img), 12):
+        lines.append('    ' + ' '.join('0x{:02X},'.format(b)
+                                       for b in img[i:i + 12]))
+    lines.append('};')
+    if coded:
+        lines.append('const size_t {0}_size = sizeof({0});'.format(name))
+    return '\n'.join(l for l in lines if l is not None) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('input', help='picture to convert')
+    parser.add_argument('output', help='C file to write')
+    parser.add_argument('--name', default='picture',
+                        help='name of the array (default: %(default)s)')
+    parser.add_argument('--flip', action='store_true',
+                        help='turn around for upside-down displays')
+    parser.add_argument('--rle', action='store_true',
+                        help='run-length code for ra8835_write_img_rle()')
+    parser.add_argument('--width', type=int,
+                        help='expected width in pixels')
+    parser.add_argument('--height', type=int,
+                        help='expected height in pixels')
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as f:
+        width, height, img = read_image(f.read())
+    if width % 8:
+        sys.exit('{}: width {} is not a multiple of 8'
+                 .format(args.input, width))
+    if (args.width and args.width != width) or \
+       (args.height and args.height != height):
+        sys.exit('{}: picture is {}x{}'.format(args.input, width, height))
+    if args.flip:
+        img = flip(img)
+    if args.rle:
+        img = rle(img)
+    with open(args.output, 'w') as f:
+        f.write(to_c(args.name, img, args.input, args.rle))
+
+
+if __name__ == '__main__':
+    main()